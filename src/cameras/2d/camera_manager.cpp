@@ -7,6 +7,7 @@
 
 #include "camera_manager.hpp"
 
+#include <cmath>
 #include <memory>
 #include "systems/camera.hpp"
 #include "../../scene/scene_manager.hpp"
@@ -14,6 +15,7 @@
 #include "../../scale/scale_manager.hpp"
 #include "../../geom/rectangle.hpp"
 #include "../../renderer/renderer.hpp"
+#include "../../utils/memory/frame_arena.hpp"
 #include "../../systems/actor.hpp"
 #include "../../systems/name.hpp"
 #include "../../systems/id.hpp"
@@ -28,11 +30,17 @@
 #include "../../systems/input.hpp"
 #include "../../systems/alpha.hpp"
 #include "../../systems/renderable.hpp"
+#include "../../systems/render_texture.hpp"
+#include "../../components/cull.hpp"
+#include "../../components/world_view.hpp"
+#include "../../components/mid_point.hpp"
+#include "../../components/rotation.hpp"
 
 namespace Zen {
 
 extern ScaleManager g_scale;
 extern entt::registry g_registry;
+extern FrameArena g_frameArena;
 
 CameraManager::CameraManager (Scene* scene_)
 	: scene (scene_)
@@ -261,32 +269,67 @@ void CameraManager::render (
 		Renderer& renderer_,
 		DisplayList& displayList_)
 {
+	displayList_.spatialIndex.update();
+
 	for (auto camera_ : cameras)
 	{
 		if (GetVisible(camera_) && GetAlpha(camera_) > 0)
 		{
 			PreRender(camera_);
 
-			auto visibleChildren_ = getVisibleChildren(displayList_.getChildren(), camera_);
+			auto visibleChildren_ = getVisibleChildren(displayList_, camera_);
 
 			renderer_.render(visibleChildren_, camera_);
 		}
 	}
 }
 
-std::vector<Entity> CameraManager::getVisibleChildren (
-		std::vector<Entity> children_,
+std::span<Entity> CameraManager::getVisibleChildren (
+		DisplayList& displayList_,
 		Entity camera_)
 {
-	std::vector<Entity> visible_;
+	std::span<const Entity> children_ = displayList_.getChildren();
+
+	auto [cull_, worldView_, midPoint_, rotation_] = g_registry.try_get<
+		Components::Cull,
+		Components::WorldView,
+		Components::MidPoint,
+		Components::Rotation>(camera_);
+
+	if (cull_ && cull_->value && worldView_)
+	{
+		Rectangle area_ = worldView_->worldView;
+
+		// The world view ignores the rotation, so look at the box around the
+		// rotated view instead
+		if (rotation_ && rotation_->value && midPoint_)
+		{
+			double cos_ = std::abs(std::cos(rotation_->value));
+			double sin_ = std::abs(std::sin(rotation_->value));
+			double width_ = cos_ * area_.width + sin_ * area_.height;
+			double height_ = sin_ * area_.width + cos_ * area_.height;
+
+			area_ = Rectangle(midPoint_->x - width_ / 2.,
+					midPoint_->y - height_ / 2., width_, height_);
+		}
+
+		displayList_.spatialIndex.query(area_, &culled);
+
+		children_ = culled;
+	}
+
+	auto visible_ = g_frameArena.allocate<Entity>(children_.size());
+	size_t count_ = 0;
 
 	for (auto& child_ : children_)
 	{
-		if (WillRender(child_, camera_))
-			visible_.emplace_back(child_);
+		// The children of a container cached as bitmap are drawn by it
+		if (WillRender(child_, camera_)
+				&& GetCachedContainer(child_) == entt::null)
+			visible_[count_++] = child_;
 	}
 
-	return visible_;
+	return visible_.first(count_);
 }
 
 Entity CameraManager::resetAll ()
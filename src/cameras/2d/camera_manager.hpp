@@ -8,6 +8,7 @@
 #ifndef ZEN_CAMERAS_SCENE2D_CAMERAMANAGER_HPP
 #define ZEN_CAMERAS_SCENE2D_CAMERAMANAGER_HPP
 
+#include <span>
 #include <vector>
 #include <functional>
 #include <string>
@@ -291,20 +292,24 @@ public:
 	void render (Renderer& renderer_, DisplayList& displayList_);
 
 	/**
-	 * Takes an array of Game Objects and a Camera and returns a new array
-	 * containing only those Game Objects that pass the `willRender` test
-	 * against the given Camera.
+	 * Takes a Display List and a Camera and returns a new array containing
+	 * only those Game Objects that pass the `willRender` test against the
+	 * given Camera.
+	 *
+	 * If the Camera culls, only the Game Objects the spatial index of the
+	 * Display List finds in its world view are tested.
 	 *
 	 * @since 0.0.0
 	 *
-	 * @param children_ A vector of Game Objects to be checked against the camera.
+	 * @param displayList_ The Display List of the Game Objects to be checked
+	 * against the camera.
 	 * @param camera_ A reference to the camera to filter the Game Objects against.
 	 *
 	 * @return A filtered list of only Game Objects within the Scene that will 
-	 * render against the given Camera.
+	 * render against the given Camera, allocated in the frame arena.
 	 */
-	std::vector<Entity> getVisibleChildren (
-			std::vector<Entity> children_,
+	std::span<Entity> getVisibleChildren (
+			DisplayList& displayList_,
 			Entity camera_);
 
 	/**
@@ -365,6 +370,14 @@ private:
 	 * @return The next available Camera ID, or 0 if they're all already in use.
 	 */
 	int getNextID ();
+
+	/**
+	 * The Game Objects found in the view of a camera by the spatial index,
+	 * kept between frames to reuse its memory.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> culled;
 };
 
 }	// namespace Zen
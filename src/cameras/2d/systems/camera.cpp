@@ -62,9 +62,6 @@ namespace Zen {
 extern entt::registry g_registry;
 extern ScaleManager g_scale;
 
-// Temporary vector, to not recreate a new one each culling pass
-static std::vector<Entity> culledObjects;
-
 // Map: Camera - Object List
 static std::map<Entity, std::vector<Entity>> renderLists;
 
@@ -92,7 +89,7 @@ Entity CreateCamera (double x, double y, double width, double height)
 	g_registry.emplace<Components::WorldView>(camera);
 	g_registry.emplace<Components::Dirty>(camera);
 	g_registry.emplace<Components::Transparent>(camera, true);
-	g_registry.emplace<Components::Cull>(camera, true);
+	g_registry.emplace<Components::Cull>(camera);
 	g_registry.emplace<Components::Origin>(camera);
 	g_registry.emplace<Components::Mask>(camera);
 	g_registry.emplace<Components::BackgroundColor>(camera);
@@ -206,8 +203,6 @@ void DestroyCamera (Entity entity)
 
 	//g _event.removeAllListeners(entity);
 
-	culledObjects.clear();
-
 	auto it = renderLists.find(entity);
 	if (it != renderLists.end())
 		renderLists.erase(it);
@@ -225,80 +220,22 @@ std::vector<Entity>* GetRenderList (Entity camera)
 	return &renderLists[camera];
 }
 
-std::vector<Entity> Cull (
-		Entity entity,
-		std::vector<Entity> renderableEntities)
+void SetCull (Entity entity, bool value)
 {
-	auto [cull, matrix, position, size, scroll] = g_registry.try_get<
-		Components::Cull,
-		Components::TransformMatrix,
-		Components::Position,
-		Components::Size,
-		Components::Scroll
-		>(entity);
-
-	ZEN_ASSERT(cull && matrix && position && size && scroll, "The entity has no 'Cull', 'TransformMatrix', 'Position', 'Size' or 'Scroll' component.");
-
-	if (!cull->value)
-		return renderableEntities;
+	auto cull = g_registry.try_get<Components::Cull>(entity);
 
-	double mva = matrix->a;
-	double mvb = matrix->b;
-	double mvc = matrix->c;
-	double mvd = matrix->d;
-
-	// First Invert Matrix
-	double determinant = (mva * mvd) - (mvb * mvc);
-
-	if (!determinant)
-		return renderableEntities;
+	ZEN_ASSERT(cull, "The entity has no 'Cull' component.");
 
-	double mve = matrix->e;
-	double mvf = matrix->f;
-
-	double cullTop = position->y;
-	double cullBottom = position->y + size->height;
-	double cullLeft = position->x;
-	double cullRight = position->x + size->width;
-
-	determinant = 1.f / determinant;
+	cull->value = value;
+}
 
-	// Clear the temporary matrix
-	culledObjects.clear();
+bool GetCull (Entity entity)
+{
+	auto cull = g_registry.try_get<Components::Cull>(entity);
 
-	for (auto& object : renderableEntities)
-	{
-		auto [oSize, oPosition, oScrollFactor, oOrigin, oItem] = g_registry.try_get<
-			Components::Size,
-			Components::Position,
-			Components::ScrollFactor,
-			Components::Origin,
-			Components::ContainerItem
-			>(object);
-
-		if (oSize && oPosition && oScrollFactor && oOrigin && oItem)
-		{
-			auto objectW = oSize->width;
-			auto objectH = oSize->height;
-			auto objectX = (oPosition->x - (scroll->x * oScrollFactor->x)) - (objectW * oOrigin->x);
-			auto objectY = (oPosition->y - (scroll->y * oScrollFactor->y)) - (objectH * oOrigin->y);
-			auto tx = (objectX * mva + objectY * mvc + mve);
-			auto ty = (objectX * mvb + objectY * mvd + mvf);
-			auto tw = ((objectX + objectW) * mva + (objectY + objectH) * mvc + mve);
-			auto th = ((objectX + objectW) * mvb + (objectY + objectH) * mvd + mvf);
-
-			if ((tw > cullLeft && tx < cullRight) && (th > cullTop && ty < cullBottom))
-			{
-				culledObjects.emplace_back(object);
-			}
-		}
-		else
-		{
-			culledObjects.emplace_back(object);
-		}
-	}
+	ZEN_ASSERT(cull, "The entity has no 'Cull' component.");
 
-	return culledObjects;
+	return cull->value;
 }
 
 Math::Vector2 GetWorldPoint (Entity entity, int x, int y)
@@ -46,16 +46,32 @@ void AddToRenderList (Entity entity, Entity child);
 std::vector<Entity>* GetRenderList (Entity camera);
 
 /**
- * Takes a vector of Game Objects pointers and returns a new vector featuring 
- * only those objects visible by this camera.
+ * Makes the camera only render the Game Objects whose bounds intersect its
+ * view, as found by the Spatial Index of the Display List. It is off by
+ * default, and the index is only built and kept up to date once a camera
+ * culls.
  *
+ * The bounds come from the position, size, origin, scale and rotation of the
+ * Game Objects. Containers, Game Objects without a size and the ones not
+ * following the camera scroll are always rendered. Turn it off for a camera
+ * rendering Game Objects that draw outside of their bounds, such as through
+ * a custom shader.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The camera.
+ * @param value `true` to cull the Game Objects out of view.
+ */
+void SetCull (Entity entity, bool value = true);
+
+/**
  * @since 0.0.0
  *
- * @param renderableObjects_ An array of Game Objects to cull.
+ * @param entity The camera.
  *
- * @return A vector of Game Objects visible to this Camera.
+ * @return `true` if the camera culls the Game Objects out of view.
  */
-std::vector<Entity> Cull (Entity entity, std::vector<Entity> renderableEntities);
+bool GetCull (Entity entity);
 
 /**
  * Converts the given `x` and `y` coordinates into World space, based on this Cameras transform.
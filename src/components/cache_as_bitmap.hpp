@@ -0,0 +1,27 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_CACHEASBITMAP_HPP
+#define ZEN_COMPONENTS_CACHEASBITMAP_HPP
+
+namespace Zen {
+namespace Components {
+
+struct CacheAsBitmap
+{
+	/**
+	 * Must the children be drawn again into the Render Texture?
+	 *
+	 * @since 0.0.0
+	 */
+	bool dirty = true;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
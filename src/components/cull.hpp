@@ -13,7 +13,7 @@ namespace Components {
 
 struct Cull
 {
-	bool value = true;
+	bool value = false;
 };
 
 }	// namespace Components
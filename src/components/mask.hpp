@@ -92,6 +92,14 @@ struct Mask
 	 */
 	int level = 0;
 
+	/**
+	 * Is the geometry currently applied with the scissor rather than the
+	 * stencil buffer? Set for each masked Game Object while it renders.
+	 *
+	 * @since 0.0.0
+	 */
+	bool scissor = false;
+
 	///////////
 	// Misc
 	///////////
@@ -0,0 +1,28 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_OPAQUE_HPP
+#define ZEN_COMPONENTS_OPAQUE_HPP
+
+namespace Zen {
+namespace Components {
+
+/**
+ * Marks a Game Object whose texture has no transparent pixel, so it can be
+ * drawn in the opaque pass of the Renderer.
+ *
+ * @since 0.0.0
+ */
+struct Opaque
+{
+	bool value = true;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
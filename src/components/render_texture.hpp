@@ -0,0 +1,59 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_RENDERTEXTURE_HPP
+#define ZEN_COMPONENTS_RENDERTEXTURE_HPP
+
+#include "../ecs/entity.hpp"
+#include "../renderer/types/gl_types.hpp"
+
+namespace Zen {
+namespace Components {
+
+struct RenderTexture
+{
+	/**
+	 * The framebuffer drawing into the texture source.
+	 *
+	 * @since 0.0.0
+	 */
+	GL_fbo framebuffer = 0;
+
+	/**
+	 * The Texture Source holding the OpenGL texture.
+	 *
+	 * @since 0.0.0
+	 */
+	Entity source = entt::null;
+
+	/**
+	 * The camera the Game Objects are drawn with. Its position is the top
+	 * left corner of the texture.
+	 *
+	 * @since 0.0.0
+	 */
+	Entity camera = entt::null;
+
+	/**
+	 * The width of the texture, in pixels.
+	 *
+	 * @since 0.0.0
+	 */
+	int width = 0;
+
+	/**
+	 * The height of the texture, in pixels.
+	 *
+	 * @since 0.0.0
+	 */
+	int height = 0;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_SPATIAL_HPP
+#define ZEN_COMPONENTS_SPATIAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zen {
+
+class SpatialIndex;
+
+namespace Components {
+
+/**
+ * The place of a Game Object in the Spatial Index of its Display List.
+ *
+ * @since 0.0.0
+ */
+struct Spatial
+{
+	/**
+	 * The index the Game Object is in.
+	 *
+	 * @since 0.0.0
+	 */
+	SpatialIndex *index = nullptr;
+
+	/**
+	 * The world bounds of the Game Object, for any flip.
+	 *
+	 * @since 0.0.0
+	 */
+	double left = 0.,
+		   top = 0.,
+		   right = 0.,
+		   bottom = 0.;
+
+	/**
+	 * The range of cells the Game Object is stored in, inclusive. Empty when
+	 * `cellRight` is smaller than `cellLeft`.
+	 *
+	 * @since 0.0.0
+	 */
+	int cellLeft = 0,
+		cellTop = 0,
+		cellRight = -1,
+		cellBottom = -1;
+
+	/**
+	 * Is the Game Object stored aside, to be returned by every query?
+	 *
+	 * This is the case when its bounds can't be known, or don't follow the
+	 * camera scroll, or span too many cells.
+	 *
+	 * @since 0.0.0
+	 */
+	bool unbounded = false;
+
+	/**
+	 * Is the Game Object waiting for its bounds to be updated?
+	 *
+	 * @since 0.0.0
+	 */
+	bool dirty = false;
+
+	/**
+	 * The last query that returned the Game Object, to return it once.
+	 *
+	 * @since 0.0.0
+	 */
+	std::uint32_t stamp = 0;
+
+	/**
+	 * The position of the Game Object in its Display List.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t order = 0;
+
+	/**
+	 * The version of the Display List the Game Object was last found in, to
+	 * leave it out of the queries once removed from the list without the
+	 * callback.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t version = 0;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
@@ -17,6 +17,13 @@ namespace Components {
 struct Type
 {
 	std::string type;
+
+	/**
+	 * The interned id of `type`, cheaper to compare. `0` means no type.
+	 *
+	 * @since 0.0.0
+	 */
+	int id = 0;
 };
 
 }	// namespace Components
@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_COMPONENTS_VERTEX_CACHE_HPP
+#define ZEN_COMPONENTS_VERTEX_CACHE_HPP
+
+#include <cstdint>
+#include <vector>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+namespace Components {
+
+/**
+ * The vertices of a sprite, retained between frames for each camera rendering
+ * it.
+ *
+ * The vertices of a camera are valid as long as the 'Dirty' component of the
+ * entity isn't set and the camera is in the same state. The first camera to
+ * render the sprite once it is dirty drops the vertices of the others.
+ *
+ * @struct VertexCache
+ * @since 0.0.0
+ */
+struct VertexCache
+{
+	/**
+	 * The state of the camera the vertices were generated for.
+	 *
+	 * @since 0.0.0
+	 */
+	struct View
+	{
+		Entity camera = entt::null;
+
+		double a = 1., b = 0., c = 0., d = 1., e = 0., f = 0.;
+
+		double scrollX = 0., scrollY = 0.;
+
+		double alpha = 1.;
+
+		bool roundPixels = false;
+
+		double width = 0., height = 0.;
+
+		bool operator== (const View&) const = default;
+	};
+
+	/**
+	 * The vertices generated for a camera.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Entry
+	{
+		View view;
+
+		/**
+		 * Was the sprite in the camera view?
+		 *
+		 * @since 0.0.0
+		 */
+		bool visible = false;
+
+		/**
+		 * The Texture Source of the sprite frame.
+		 *
+		 * @since 0.0.0
+		 */
+		Entity source = entt::null;
+
+		/**
+		 * The vertices of the quad, in the vertex format of the pipeline,
+		 * without the texture unit.
+		 *
+		 * @since 0.0.0
+		 */
+		std::vector<std::uint8_t> vertices;
+	};
+
+	/**
+	 * One entry per camera rendering the sprite.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entry> entries;
+};
+
+}	// namespace Components
+}	// namespace Zen
+
+#endif
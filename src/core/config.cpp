@@ -176,6 +176,71 @@ GameConfig& GameConfig::setMipMapFilter (GLenum filter)
 	return *this;
 }
 
+GameConfig& GameConfig::setBatchReorder (bool flag)
+{
+	renderConfig.batchReorder = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setBatchThreads (int threads)
+{
+	if (threads < 0) threads = 0;
+
+	renderConfig.batchThreads = threads;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setTextureArrays (bool flag)
+{
+	renderConfig.textureArrays = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setTextureArrayLayers (int layers)
+{
+	renderConfig.textureArrayLayers = layers;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setTextureArrayMaxSize (int size)
+{
+	renderConfig.textureArrayMaxSize = size;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setGpuTimers (bool flag)
+{
+	renderConfig.gpuTimers = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setOpaquePass (bool flag)
+{
+	renderConfig.opaquePass = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setProgramCacheDirectory (std::string directory)
+{
+	renderConfig.programCacheDirectory = directory;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setRenderBackend (RENDER_BACKEND backend)
+{
+	renderConfig.backend = backend;
+
+	return *this;
+}
+
 GameConfig& GameConfig::setBackgroundColor (unsigned int color)
 {
 	SetHex(&renderConfig.backgroundColor, color);
@@ -205,4 +270,25 @@ GameConfig& GameConfig::setLoaderPrefix (std::string prefix)
 	return *this;
 }
 
+GameConfig& GameConfig::setAutoAtlas (bool flag)
+{
+	autoAtlas = flag;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setAutoAtlasMaxSize (int size)
+{
+	autoAtlasMaxSize = size;
+
+	return *this;
+}
+
+GameConfig& GameConfig::setAutoAtlasPageSize (int size)
+{
+	autoAtlasPageSize = size;
+
+	return *this;
+}
+
 }	// namespace Zen
@@ -227,6 +227,71 @@ public:
 	 */
 	GameConfig& setMipMapFilter (GLenum filter);
 
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param flag If true, reorder the display lists to merge batches.
+	 */
+	GameConfig& setBatchReorder (bool flag);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param threads The number of threads generating Sprite vertices.
+	 */
+	GameConfig& setBatchThreads (int threads);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param flag Should the Texture Sources be packed into texture arrays?
+	 */
+	GameConfig& setTextureArrays (bool flag);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param layers The maximum number of layers of a texture array.
+	 */
+	GameConfig& setTextureArrayLayers (int layers);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param size The maximum size of a Texture Source packed in an array.
+	 */
+	GameConfig& setTextureArrayMaxSize (int size);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param flag Should the GPU time of the rendering be measured?
+	 */
+	GameConfig& setGpuTimers (bool flag);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param flag Should the opaque Game Objects be drawn first, with depth
+	 * testing?
+	 */
+	GameConfig& setOpaquePass (bool flag);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param directory The directory to cache the linked shader programs in,
+	 * or an empty string to disable the cache.
+	 */
+	GameConfig& setProgramCacheDirectory (std::string directory);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param backend Where the frames are sent, see `RENDER_BACKEND`.
+	 */
+	GameConfig& setRenderBackend (RENDER_BACKEND backend);
+
 	/**
 	 * Sets the background color used by the renderer for cleaning the screen.
 	 *
@@ -263,6 +328,27 @@ public:
 	 */
 	GameConfig& setLoaderPrefix (std::string prefix);
 
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param flag Should the small images be packed into shared atlas pages?
+	 */
+	GameConfig& setAutoAtlas (bool flag);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param size The maximum width and height of a packed image.
+	 */
+	GameConfig& setAutoAtlasMaxSize (int size);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param size The width and height of an atlas page.
+	 */
+	GameConfig& setAutoAtlasPageSize (int size);
+
 	/**
 	 * The delta time between each game step when the window isn't visible, as it
 	 * isn't rendering and so not vsynced.
@@ -406,6 +492,33 @@ public:
 	 */
 	std::string loaderPrefix = "";
 
+	/**
+	 * Should the images added with `TextureManager::addImage` be packed into
+	 * shared atlas pages, so the Game Objects using them can be batched
+	 * together?
+	 *
+	 * Each image keeps its key and its `__BASE` frame, which points into the
+	 * page. The space of a removed image isn't reused.
+	 *
+	 * @since 0.0.0
+	 */
+	bool autoAtlas = false;
+
+	/**
+	 * The maximum width and height of an image packed in an atlas page.
+	 * Larger images get their own texture.
+	 *
+	 * @since 0.0.0
+	 */
+	int autoAtlasMaxSize = 256;
+
+	/**
+	 * The width and height of the atlas pages.
+	 *
+	 * @since 0.0.0
+	 */
+	int autoAtlasPageSize = 2048;
+
 	// Default / Missing Images
 	std::string pngPrefix = "iVBORw0KGgoAAAANSUhEUgAAACAAAAAg";
 
@@ -15,6 +15,7 @@
 #include "../texture/texture_manager.hpp"
 #include "../scale/scale_manager.hpp"
 #include "../renderer/renderer.hpp"
+#include "../utils/memory/frame_arena.hpp"
 #include "../scene/scene_manager.hpp"
 #include "../input/input_manager.hpp"
 #include "../input/mouse/mouse_manager.hpp"
@@ -38,6 +39,7 @@ KeyboardManager g_keyboard;
 AudioManager g_audio;
 SceneManager g_scene;
 TextManager g_text;
+FrameArena g_frameArena;
 
 Game::Game (GameConfig& config_)
 	: config (config_)
@@ -54,6 +56,13 @@ Game::~Game ()
 {
 	g_event.removeAllListeners();
 
+	// Nothing was created but the window, which cleaned up after itself
+	if (!isBooted)
+		return;
+
+	// The OpenGL objects must go before the context
+	g_renderer.destroy();
+
 	// FIXME
 	// Destroying the SDL_Renderer from inside the Window global object makes
 	// everything crash to the ground, it works from here, but it would be good to
@@ -63,9 +72,15 @@ Game::~Game ()
 
 void Game::boot ()
 {
-	isBooted = true;
+	if (g_window.create(&config)) {
+		MessageError("The game could not boot without a window and an OpenGL context");
+
+		hasFailed = true;
 
-	g_window.create(&config);
+		return;
+	}
+
+	isBooted = true;
 
 	g_texture.boot(&config);
 
@@ -118,11 +133,15 @@ void Game::step (Uint32 time_, Uint32 delta_)
 		return;
 	}
 
+	// Release the temporary data of the previous frame
+	g_frameArena.reset();
+
 	// Handle SDL events
 	handleSDLEvents();
 
-	// Only run the logic without rendering anything if the window is hidden
-	if (!isVisible)
+	// Only run the logic without rendering anything if the window is hidden,
+	// unless the rendering is only recorded
+	if (!isVisible && config.renderConfig.backend != RENDER_BACKEND::RECORD)
 	{
 		headlessStep(time_, delta_);
 		return;
@@ -185,6 +185,14 @@ public:
 	 */
 	bool isBooted = false;
 
+	/**
+	 * A flag indicating that the boot process stopped, as the window or its
+	 * OpenGL context could not be created. The game never ran.
+	 *
+	 * @since 0.0.0
+	 */
+	bool hasFailed = false;
+
 	/**
 	 * A flag indicating if this Game instance is currently running its game
 	 * step or not.
@@ -8,8 +8,10 @@
 #ifndef ZEN_CORE_CONFIG_RENDER_HPP
 #define ZEN_CORE_CONFIG_RENDER_HPP
 
+#include <string>
 #include <GL/glew.h>
 #include "../../display/types/color.hpp"
+#include "../../enums/render_backend.hpp"
 
 namespace Zen {
 
@@ -91,6 +93,99 @@ struct RenderConfig {
 	 */
 	GLenum mipmapFilter = GL_LINEAR;
 
+	/**
+	 * Should the display list of each camera be reordered to merge the
+	 * batches of Game Objects sharing the same state?
+	 *
+	 * Game Objects are only reordered within a depth layer, when their bounds
+	 * don't overlap, so the rendered image is unchanged. See `RenderQueue`.
+	 *
+	 * @since 0.0.0
+	 */
+	bool batchReorder = false;
+
+	/**
+	 * The number of worker threads generating the vertices of the runs of
+	 * Sprites in parallel. The default, 0, generates them on the main thread.
+	 *
+	 * @since 0.0.0
+	 */
+	int batchThreads = 0;
+
+	/**
+	 * Should the Texture Sources of the same size be packed into texture
+	 * arrays, so the Multi Pipeline doesn't flush when it runs out of texture
+	 * units? See `TextureArrays`.
+	 *
+	 * This uses 4 of the `maxTextures` units, and keeps a copy of the packed
+	 * sources in video memory.
+	 *
+	 * @since 0.0.0
+	 */
+	bool textureArrays = false;
+
+	/**
+	 * The maximum number of layers of a texture array, up to 256.
+	 *
+	 * @since 0.0.0
+	 */
+	int textureArrayLayers = 64;
+
+	/**
+	 * The maximum width and height of a Texture Source packed in a texture
+	 * array. Larger sources use their own texture unit.
+	 *
+	 * @since 0.0.0
+	 */
+	int textureArrayMaxSize = 512;
+
+	/**
+	 * Should the GPU time of the pipeline flushes, cameras and post pipelines
+	 * be measured? See `Renderer::getGpuTimings`.
+	 *
+	 * This flushes the batch around each camera.
+	 *
+	 * @since 0.0.0
+	 */
+	bool gpuTimers = false;
+
+	/**
+	 * Should the Game Objects set as opaque be drawn first, front to back,
+	 * with depth testing? The other ones are then drawn back to front, and
+	 * the hidden pixels of both are never shaded. See `SetOpaque`.
+	 *
+	 * This needs a depth buffer in the window, and is only used by the cameras
+	 * rendering directly to it.
+	 *
+	 * @since 0.0.0
+	 */
+	bool opaquePass = false;
+
+	/**
+	 * The directory to store the linked shader programs in, so the next
+	 * launches don't compile them again. Empty to disable the cache.
+	 *
+	 * The binaries are tied to the driver that produced them, a binary that
+	 * is rejected is simply compiled again from the sources.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string programCacheDirectory;
+
+	/**
+	 * Where the frames are sent. With `RENDER_BACKEND::RECORD`, nothing is
+	 * drawn, the commands are recorded in the `CommandLog` of the Renderer
+	 * instead, and the window is hidden.
+	 *
+	 * This backend is not GPU-free: it still needs a display, a window and
+	 * an OpenGL 3.3 context, and the textures, shaders and buffers are still
+	 * created and uploaded to the GPU. Only the drawing is skipped. Without a
+	 * display or a driver, the Game fails to boot, see `Game::hasFailed`.
+	 *
+	 * @since 0.0.0
+	 */
+	RENDER_BACKEND backend = RENDER_BACKEND::OPENGL;
+
 	Color backgroundColor;
 };
 
@@ -0,0 +1,47 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_BUFFERSTREAMING_HPP
+#define ZEN_ENUMS_BUFFERSTREAMING_HPP
+
+namespace Zen {
+
+/**
+ * How a pipeline streams its batched vertices to the GPU when it flushes.
+ *
+ * @since 0.0.0
+ */
+enum class BUFFER_STREAMING {
+	/**
+	 * A single vertex buffer, updated with `glBufferSubData`, or
+	 * `glBufferData` when the batch is full.
+	 */
+	SUB_DATA = 0,
+
+	/**
+	 * A single vertex buffer, orphaned with a `glBufferData` of `nullptr`
+	 * before every upload so the driver can hand out fresh storage instead of
+	 * waiting for the GPU to release the previous batch.
+	 */
+	ORPHAN,
+
+	/**
+	 * Several vertex buffers, used one after the other in a round-robin
+	 * fashion.
+	 */
+	ROUND_ROBIN,
+
+	/**
+	 * A single vertex buffer split in several regions, written with an
+	 * unsynchronized `glMapBufferRange` and guarded by a fence per region.
+	 */
+	MAP_UNSYNCHRONIZED
+};
+
+}	// namespace Zen
+
+#endif
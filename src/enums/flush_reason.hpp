@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_FLUSHREASON_HPP
+#define ZEN_ENUMS_FLUSHREASON_HPP
+
+namespace Zen {
+
+/**
+ * Why a pipeline flushed its batch. Counted in the `RenderStats`.
+ *
+ * @since 0.0.0
+ */
+enum class FLUSH_REASON {
+	/**
+	 * Any other reason, such as a framebuffer change or the end of the frame.
+	 */
+	OTHER = 0,
+
+	/**
+	 * The vertex buffer of the pipeline was full.
+	 */
+	BATCH_FULL,
+
+	/**
+	 * All the texture units were used.
+	 */
+	TEXTURE_UNITS,
+
+	/**
+	 * Another pipeline, shader or post pipeline was set.
+	 */
+	PIPELINE,
+
+	/**
+	 * The blend mode changed.
+	 */
+	BLEND,
+
+	/**
+	 * A mask started or ended.
+	 */
+	MASK,
+
+	/**
+	 * The number of reasons.
+	 */
+	COUNT
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_GPUTIMING_HPP
+#define ZEN_ENUMS_GPUTIMING_HPP
+
+namespace Zen {
+
+/**
+ * What a GPU timing of the GpuTimer measures.
+ *
+ * @since 0.0.0
+ */
+enum class GPU_TIMING {
+	/**
+	 * The draw calls of the flushes of a pipeline.
+	 */
+	FLUSH = 0,
+
+	/**
+	 * Everything drawn by a camera, its post pipelines included.
+	 */
+	CAMERA,
+
+	/**
+	 * The draws of a post pipeline, in its `onDraw` handler.
+	 */
+	POSTFX
+};
+
+}	// namespace Zen
+
+#endif
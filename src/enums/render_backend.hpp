@@ -0,0 +1,34 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_RENDERBACKEND_HPP
+#define ZEN_ENUMS_RENDERBACKEND_HPP
+
+namespace Zen {
+
+/**
+ * Where the Renderer sends the work of a frame.
+ *
+ * @since 0.0.0
+ */
+enum class RENDER_BACKEND {
+	/**
+	 * Draw with OpenGL.
+	 */
+	OPENGL = 0,
+
+	/**
+	 * Run the whole CPU side of the rendering, but record the draw calls,
+	 * vertex payloads, clears and state changes into the `CommandLog` of the
+	 * Renderer instead of drawing anything.
+	 */
+	RECORD
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_ENUMS_RENDERCOMMAND_HPP
+#define ZEN_ENUMS_RENDERCOMMAND_HPP
+
+namespace Zen {
+
+/**
+ * The kinds of commands recorded in a `CommandLog`.
+ *
+ * @since 0.0.0
+ */
+enum class RENDER_COMMAND {
+	/**
+	 * A draw call. The values are the topology, the first vertex and the
+	 * number of vertices, and the vertex payload is kept for the batches.
+	 */
+	DRAW = 0,
+
+	/**
+	 * A clear of the buffers given by the first value.
+	 */
+	CLEAR,
+
+	/**
+	 * A change of the OpenGL state, named after the `StateCache` method that
+	 * made it, with its arguments as values.
+	 */
+	STATE,
+
+	/**
+	 * The end of the frame, when the window would have been swapped.
+	 */
+	PRESENT
+};
+
+}	// namespace Zen
+
+#endif
@@ -160,6 +160,23 @@ private:
 		>
 	> eventMap;
 
+	/**
+	 * The copies of the listeners of the events being emitted, one for each
+	 * nested emission, kept between emissions so emitting doesn't allocate.
+	 *
+	 * A deque, as adding a level must not move the copies in use.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<std::vector<std::shared_ptr<ListenerBase>>> emitting;
+
+	/**
+	 * The number of emissions in progress.
+	 *
+	 * @since 0.0.0
+	 */
+	size_t emitDepth = 0;
+
 public:
 	/**
 	 * Add a listener for a given event, using a functor as a callback.
@@ -404,7 +421,7 @@ public:
 	 * @return `true` if the event had listeners, else `false`.
 	 */
 	template <typename... Args>
-	bool emit (Entity entity_, std::string eventName_, Args&&... args_)
+	bool emit (Entity entity_, const std::string& eventName_, Args&&... args_)
 	{
 		// Check if there are listeners for this entity
 		auto iteratorEnt_ = eventMap.find(entity_);
@@ -418,7 +435,11 @@ public:
 
 		// Create a copy of the callbacks list to make it safe to modify the
 		// original list
-		std::deque<std::shared_ptr<ListenerBase>> callbacks = iterator_->second;
+		if (emitDepth == emitting.size())
+			emitting.emplace_back();
+
+		auto& callbacks = emitting[emitDepth++];
+		callbacks.assign(iterator_->second.begin(), iterator_->second.end());
 
 		// Iterator over the original list
 		auto ol_ = iterator_->second.begin();
@@ -440,6 +461,10 @@ public:
 			}
 		}
 
+		// Release the listeners, but keep the memory of the copy
+		callbacks.clear();
+		emitDepth--;
+
 		// Have the map been emptied during the event emission?
 		if (!eventMap.empty() &&
 			eventMap.contains(entity_) &&
@@ -468,7 +493,7 @@ public:
 	 * @return `true` if the event had listeners, else `false`.
 	 */
 	template <typename... Args>
-	bool emit (std::string eventName_, Args&&... args_)
+	bool emit (const std::string& eventName_, Args&&... args_)
 	{
 		// Cast `entt::null` to `Entity` to remove ambiguity (Otherwise it could
 		// be converted to std::string)
@@ -19,12 +19,16 @@ DisplayList::DisplayList ()
 {
 	unique = true;
 
-	addCallback = [this] ([[maybe_unused]] Entity gameObject) {
+	addCallback = [this] (Entity gameObject) {
 		queueDepthSort();
+
+		spatialIndex.add(gameObject);
 	};
 
-	removeCallback = [this] ([[maybe_unused]] Entity gameObject) {
+	removeCallback = [this] (Entity gameObject) {
 		queueDepthSort();
+
+		spatialIndex.remove(gameObject);
 	};
 
 	sortCallback = [] (Entity childA,  Entity childB) {
@@ -34,6 +38,9 @@ DisplayList::DisplayList ()
 
 DisplayList::~DisplayList ()
 {
+	// Faster than unlinking the children one by one
+	spatialIndex.clear();
+
 	for (auto child = list.rbegin(); child != list.rend(); child++)
 		g_registry.destroy(*child);
 }
@@ -47,6 +54,7 @@ void DisplayList::depthSort ()
 {
 	if (sortChildrenFlag) {
 		std::stable_sort(list.begin(), list.end(), sortByDepth);
+		version++;
 
 		sortChildrenFlag = false;
 	}
@@ -57,7 +65,7 @@ bool DisplayList::sortByDepth (Entity childA, Entity childB)
 	return GetDepth(childA) < GetDepth(childB);
 }
 
-std::vector<Entity> DisplayList::getChildren ()
+std::span<const Entity> DisplayList::getChildren ()
 {
 	return list;
 }
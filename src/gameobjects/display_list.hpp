@@ -9,10 +9,12 @@
 #define ZEN_GAMEOBJECT_DISPLAYLIST_H
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "../ecs/entity.hpp"
 #include "../structs/list.hpp"
+#include "spatial_index.hpp"
 
 namespace Zen {
 
@@ -39,6 +41,14 @@ public:
 	 */
 	bool sortChildrenFlag = false;
 
+	/**
+	 * The world bounds of the Game Objects, to only render the ones in view
+	 * of each camera.
+	 *
+	 * @since 0.0.0
+	 */
+	SpatialIndex spatialIndex {this};
+
 	/**
 	 * @since 0.0.0
 	 */
@@ -49,6 +59,10 @@ public:
 	 */
 	~DisplayList ();
 
+	// The Spatial Index points to the list
+	DisplayList (const DisplayList&) = delete;
+	DisplayList& operator= (const DisplayList&) = delete;
+
 	/**
 	 * Force a sort of the display list on the next call to depthSort.
 	 *
@@ -77,13 +91,14 @@ public:
 	static bool sortByDepth (Entity childA, Entity childB);
 
 	/**
-	 * Returns a vector which contains all objects currently on the DisplayList.
+	 * Returns a view of all objects currently on the DisplayList, valid until
+	 * the list is next modified.
 	 *
 	 * @since 0.0.0
 	 *
 	 * @return The GameObject instances.
 	 */
-	std::vector<Entity> getChildren ();
+	std::span<const Entity> getChildren ();
 
 	int getIndex (Entity child);
 
@@ -34,6 +34,8 @@
 #include "../systems/textured.hpp"
 #include "../systems/text.hpp"
 #include "../systems/renderable.hpp"
+#include "../systems/type.hpp"
+#include "../systems/render_texture.hpp"
 #include "render_functions.hpp"
 
 namespace Zen {
@@ -69,7 +71,7 @@ Entity GameObjectFactory::image (double x, double y, std::string key, std::strin
 	g_registry.emplace<Components::Visible>(img);
 	g_registry.emplace<Components::Crop>(img);
 	g_registry.emplace<Components::Actor>(img, scene);
-	g_registry.emplace<Components::Type>(img, "image");
+	SetType(img, "image");
 
 	Components::Renderable &r = g_registry.emplace<Components::Renderable>(img);
 	r.render = Render_image;
@@ -84,6 +86,45 @@ Entity GameObjectFactory::image (double x, double y, std::string key, std::strin
 	return img;
 }
 
+Entity GameObjectFactory::renderTexture (double x, double y, int width,
+		int height, std::string key)
+{
+	auto rt = g_registry.create();
+
+	g_registry.emplace<Components::Alpha>(rt);
+	g_registry.emplace<Components::BlendMode>(rt);
+	g_registry.emplace<Components::Depth>(rt);
+	g_registry.emplace<Components::Flip>(rt);
+	g_registry.emplace<Components::Bounds>(rt);
+	g_registry.emplace<Components::Mask>(rt);
+	g_registry.emplace<Components::Origin>(rt);
+	g_registry.emplace<Components::ScrollFactor>(rt);
+	g_registry.emplace<Components::Size>(rt);
+	g_registry.emplace<Components::Textured>(rt);
+	g_registry.emplace<Components::Tint>(rt);
+	g_registry.emplace<Components::Position>(rt, x, y);
+	g_registry.emplace<Components::Rotation>(rt);
+	g_registry.emplace<Components::Scale>(rt);
+	g_registry.emplace<Components::Visible>(rt);
+	g_registry.emplace<Components::Crop>(rt);
+	g_registry.emplace<Components::Actor>(rt, scene);
+	SetType(rt, "renderTexture");
+
+	Components::Renderable &r = g_registry.emplace<Components::Renderable>(rt);
+	r.render = Render_renderTexture;
+
+	key = InitRenderTexture(rt, width, height, key);
+
+	SetTexture(rt, key);
+	SetSizeToFrame(rt);
+	SetOriginFromFrame(rt);
+	InitPipeline(rt);
+
+	scene->children.add(rt);
+
+	return rt;
+}
+
 Entity GameObjectFactory::text (double x, double y, std::string text, TextStyle style)
 {
 	auto txt = g_registry.create();
@@ -103,7 +144,7 @@ Entity GameObjectFactory::text (double x, double y, std::string text, TextStyle
 	g_registry.emplace<Components::Scale>(txt);
 	g_registry.emplace<Components::Visible>(txt);
 	g_registry.emplace<Components::Actor>(txt, scene);
-	g_registry.emplace<Components::Type>(txt, "text");
+	SetType(txt, "text");
 
 	Components::Renderable &r = g_registry.emplace<Components::Renderable>(txt);
 	r.render = Render_text;
@@ -45,6 +45,34 @@ public:
 	 */
 	Entity image (double x, double y, std::string key, std::string frame = "");
 
+	/**
+	 * Creates an image whose texture can be drawn to, with `DrawRenderTexture`.
+	 *
+	 * Its texture is added to the Texture Manager, so other Game Objects can
+	 * use it too. To draw a group of Game Objects once and then display them
+	 * as a single quad, set them as its children with `SetParent` and call
+	 * `SetCacheAsBitmap` on it.
+	 *
+	 * ```cpp
+	 * auto hud = add.renderTexture(0, 0, 800, 100);
+	 * SetOrigin(hud, 0);
+	 * SetCacheAsBitmap(hud);
+	 *
+	 * auto icon = add.image(10, 10, "icon");
+	 * SetParent(icon, hud);
+	 * ```
+	 *
+	 * @since 0.0.0
+	 * @param x The position of the Render Texture on the x axis
+	 * @param y The position of the Render Texture on the y axis
+	 * @param width The width of the texture
+	 * @param height The height of the texture
+	 * @param key The key of the texture in the Texture Manager. A unique one
+	 * is generated if empty.
+	 */
+	Entity renderTexture (double x, double y, int width, int height,
+			std::string key = "");
+
 	/**
 	 * ```cpp
 	 * auto text = this.add.text(100, 150, "Score: 0", {
@@ -8,6 +8,7 @@
 #include "render_functions.hpp"
 #include "../components/renderable.hpp"
 #include "../cameras/2d/systems/camera.hpp"
+#include "../systems/render_texture.hpp"
 #include "../renderer/pipelines/multi_pipeline.hpp"
 
 namespace Zen {
@@ -33,4 +34,13 @@ void Render_text (Entity entity, Entity camera,
 			matrix);
 }
 
+void Render_renderTexture (Entity entity, Entity camera,
+		Components::TransformMatrix* matrix)
+{
+	// Draw the children first if cached as bitmap, then the texture as a quad
+	UpdateCacheAsBitmap(entity);
+
+	Render_image(entity, camera, matrix);
+}
+
 }	// namespace Zen
@@ -19,6 +19,9 @@ void Render_image (Entity entity, Entity camera,
 void Render_text (Entity entity, Entity camera,
 		Components::TransformMatrix* matrix);
 
+void Render_renderTexture (Entity entity, Entity camera,
+		Components::TransformMatrix* matrix);
+
 }	// namespace Zen
 
 #endif
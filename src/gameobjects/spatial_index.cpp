@@ -0,0 +1,366 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "spatial_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include "../components/position.hpp"
+#include "../components/size.hpp"
+#include "../components/origin.hpp"
+#include "../components/scale.hpp"
+#include "../components/rotation.hpp"
+#include "../components/scroll_factor.hpp"
+#include "../components/container.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+SpatialIndex::SpatialIndex (const List<Entity>* list_)
+	: list (list_)
+{
+	// Connecting it again for every index replaces the previous connection
+	g_registry.on_destroy<Components::Spatial>()
+		.connect<&SpatialIndex::onDestroy>();
+}
+
+SpatialIndex::~SpatialIndex ()
+{
+	clear();
+}
+
+void SpatialIndex::onDestroy (entt::registry& registry_, Entity entity_)
+{
+	auto& spatial_ = registry_.get<Components::Spatial>(entity_);
+
+	if (spatial_.index)
+		spatial_.index->unlink(entity_, &spatial_);
+}
+
+void SpatialIndex::clear ()
+{
+	// Nothing was ever linked
+	if (!enabled)
+		return;
+
+	// Emptied first, so removing the components has nothing to unlink
+	cells.clear();
+	unbounded.clear();
+	dirty.clear();
+	enabled = false;
+
+	std::vector<Entity> linked_;
+	for (auto entity_ : g_registry.view<Components::Spatial>()) {
+		if (g_registry.get<Components::Spatial>(entity_).index == this)
+			linked_.push_back(entity_);
+	}
+
+	for (auto entity_ : linked_)
+		g_registry.remove<Components::Spatial>(entity_);
+}
+
+std::uint64_t SpatialIndex::getKey (int x_, int y_)
+{
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x_)) << 32)
+		| static_cast<std::uint32_t>(y_);
+}
+
+Components::Spatial* SpatialIndex::getSpatial (Entity entity_)
+{
+	if (!g_registry.valid(entity_))
+		return nullptr;
+
+	auto spatial_ = g_registry.try_get<Components::Spatial>(entity_);
+
+	if (!spatial_ || spatial_->index != this)
+		return nullptr;
+
+	return spatial_;
+}
+
+void SpatialIndex::markDirty (Entity entity_)
+{
+	dirty.push_back(entity_);
+}
+
+void SpatialIndex::add (Entity entity_)
+{
+	if (enabled)
+		insert(entity_);
+}
+
+void SpatialIndex::remove (Entity entity_)
+{
+	// Unlinked by `onDestroy`
+	if (enabled && getSpatial(entity_))
+		g_registry.remove<Components::Spatial>(entity_);
+}
+
+Components::Spatial* SpatialIndex::insert (Entity entity_)
+{
+	auto spatial_ = g_registry.try_get<Components::Spatial>(entity_);
+
+	if (spatial_ && spatial_->index == this)
+		return spatial_;
+
+	// Moved from another Display List
+	if (spatial_)
+		spatial_->index->unlink(entity_, spatial_);
+
+	spatial_ = &g_registry.emplace_or_replace<Components::Spatial>(entity_);
+	spatial_->index = this;
+	spatial_->unbounded = true;
+	spatial_->dirty = true;
+	unbounded.push_back(entity_);
+	dirty.push_back(entity_);
+
+	return spatial_;
+}
+
+void SpatialIndex::update ()
+{
+	if (!enabled)
+		return;
+
+	for (auto entity_ : dirty) {
+		auto spatial_ = getSpatial(entity_);
+
+		// Removed from the list since
+		if (!spatial_ || !spatial_->dirty)
+			continue;
+
+		spatial_->dirty = false;
+
+		Components::Spatial bounds_ = *spatial_;
+		bounds_.unbounded = !computeBounds(entity_, &bounds_);
+
+		// Still in the same cells, only its bounds changed
+		if (!bounds_.unbounded && !spatial_->unbounded
+				&& bounds_.cellLeft == spatial_->cellLeft
+				&& bounds_.cellTop == spatial_->cellTop
+				&& bounds_.cellRight == spatial_->cellRight
+				&& bounds_.cellBottom == spatial_->cellBottom) {
+			*spatial_ = bounds_;
+
+			continue;
+		}
+
+		unlink(entity_, spatial_);
+		*spatial_ = bounds_;
+		link(entity_, spatial_);
+	}
+
+	dirty.clear();
+}
+
+void SpatialIndex::build ()
+{
+	enabled = true;
+
+	updateOrder();
+
+	update();
+}
+
+void SpatialIndex::updateOrder ()
+{
+	listVersion = list->version;
+
+	for (std::size_t i = 0; i < list->list.size(); i++) {
+		// Added without the callback, or before the index was built
+		auto spatial_ = insert(list->list[i]);
+
+		spatial_->order = i;
+		spatial_->version = listVersion;
+	}
+}
+
+bool SpatialIndex::computeBounds (Entity entity_,
+		Components::Spatial* spatial_)
+{
+	auto [position_, size_] = g_registry.try_get<Components::Position,
+		 Components::Size>(entity_);
+
+	// Game Objects without a size draw anywhere, such as graphics
+	if (!position_ || !size_ || !size_->width || !size_->height)
+		return false;
+
+	// The children of a container are drawn around it, wherever they are
+	if (g_registry.has<Components::Container>(entity_))
+		return false;
+
+	// Game Objects following the camera don't have fixed world bounds
+	auto scrollFactor_ = g_registry.try_get<Components::ScrollFactor>(entity_);
+	if (scrollFactor_ && (scrollFactor_->x != 1. || scrollFactor_->y != 1.))
+		return false;
+
+	auto [origin_, scale_, rotation_] = g_registry.try_get<
+		Components::Origin, Components::Scale, Components::Rotation>(entity_);
+
+	double width_ = size_->width * (scale_ ? std::abs(scale_->x) : 1.);
+	double height_ = size_->height * (scale_ ? std::abs(scale_->y) : 1.);
+	double originX_ = origin_ ? origin_->x : 0.5;
+	double originY_ = origin_ ? origin_->y : 0.5;
+
+	// Symmetric around the position, so flipping the Game Object, which
+	// mirrors it around its origin, doesn't need to update the bounds
+	double extentX_ = std::max(originX_, 1. - originX_) * width_;
+	double extentY_ = std::max(originY_, 1. - originY_) * height_;
+
+	if (rotation_ && rotation_->value) {
+		double cos_ = std::abs(std::cos(rotation_->value));
+		double sin_ = std::abs(std::sin(rotation_->value));
+
+		double x_ = cos_ * extentX_ + sin_ * extentY_;
+		double y_ = sin_ * extentX_ + cos_ * extentY_;
+
+		extentX_ = x_;
+		extentY_ = y_;
+	}
+
+	spatial_->left = position_->x - extentX_;
+	spatial_->top = position_->y - extentY_;
+	spatial_->right = position_->x + extentX_;
+	spatial_->bottom = position_->y + extentY_;
+
+	double cellLeft_ = std::floor(spatial_->left / cellSize);
+	double cellTop_ = std::floor(spatial_->top / cellSize);
+	double cellRight_ = std::floor(spatial_->right / cellSize);
+	double cellBottom_ = std::floor(spatial_->bottom / cellSize);
+
+	// Also catches the NaN and infinite bounds
+	if (!((cellRight_ - cellLeft_ + 1.) * (cellBottom_ - cellTop_ + 1.)
+				<= MAX_CELLS)
+			|| std::abs(cellLeft_) > INT32_MAX / 2
+			|| std::abs(cellTop_) > INT32_MAX / 2)
+		return false;
+
+	spatial_->cellLeft = cellLeft_;
+	spatial_->cellTop = cellTop_;
+	spatial_->cellRight = cellRight_;
+	spatial_->cellBottom = cellBottom_;
+
+	return true;
+}
+
+void SpatialIndex::unlink (Entity entity_, Components::Spatial* spatial_)
+{
+	auto erase_ = [entity_] (std::vector<Entity>& entities_) {
+		auto it_ = std::find(entities_.begin(), entities_.end(), entity_);
+
+		if (it_ != entities_.end()) {
+			*it_ = entities_.back();
+			entities_.pop_back();
+		}
+	};
+
+	if (spatial_->unbounded) {
+		erase_(unbounded);
+
+		return;
+	}
+
+	for (int y = spatial_->cellTop; y <= spatial_->cellBottom; y++) {
+		for (int x = spatial_->cellLeft; x <= spatial_->cellRight; x++) {
+			auto cell_ = cells.find(getKey(x, y));
+
+			if (cell_ == cells.end())
+				continue;
+
+			erase_(cell_->second);
+
+			if (cell_->second.empty())
+				cells.erase(cell_);
+		}
+	}
+}
+
+void SpatialIndex::link (Entity entity_, Components::Spatial* spatial_)
+{
+	if (spatial_->unbounded) {
+		unbounded.push_back(entity_);
+
+		return;
+	}
+
+	for (int y = spatial_->cellTop; y <= spatial_->cellBottom; y++)
+		for (int x = spatial_->cellLeft; x <= spatial_->cellRight; x++)
+			cells[getKey(x, y)].push_back(entity_);
+}
+
+void SpatialIndex::query (const Rectangle& area_, std::vector<Entity>* output_)
+{
+	output_->clear();
+	found.clear();
+	stamp++;
+
+	if (!enabled)
+		build();
+	else if (listVersion != list->version)
+		updateOrder();
+
+	double right_ = area_.x + area_.width;
+	double bottom_ = area_.y + area_.height;
+
+	auto test_ = [&] (Entity entity_) {
+		auto spatial_ = getSpatial(entity_);
+
+		if (!spatial_ || spatial_->stamp == stamp
+				|| spatial_->version != listVersion)
+			return;
+
+		spatial_->stamp = stamp;
+
+		if (spatial_->right > area_.x && spatial_->left < right_
+				&& spatial_->bottom > area_.y && spatial_->top < bottom_)
+			found.emplace_back(spatial_->order, entity_);
+	};
+
+	double cellLeft_ = std::floor(area_.x / cellSize);
+	double cellTop_ = std::floor(area_.y / cellSize);
+	double cellRight_ = std::floor(right_ / cellSize);
+	double cellBottom_ = std::floor(bottom_ / cellSize);
+	double count_ = (cellRight_ - cellLeft_ + 1.) * (cellBottom_ - cellTop_ + 1.);
+
+	// A view zoomed out far enough spans more cells than there are filled
+	if (count_ <= cells.size()) {
+		for (int y = cellTop_; y <= cellBottom_; y++) {
+			for (int x = cellLeft_; x <= cellRight_; x++) {
+				auto cell_ = cells.find(getKey(x, y));
+
+				if (cell_ == cells.end())
+					continue;
+
+				for (auto entity_ : cell_->second)
+					test_(entity_);
+			}
+		}
+	}
+	else {
+		for (auto& [key_, entities_] : cells)
+			for (auto entity_ : entities_)
+				test_(entity_);
+	}
+
+	for (auto entity_ : unbounded) {
+		auto spatial_ = getSpatial(entity_);
+
+		if (spatial_ && spatial_->version == listVersion)
+			found.emplace_back(spatial_->order, entity_);
+	}
+
+	std::sort(found.begin(), found.end(), [] (const auto& a, const auto& b) {
+		return a.first < b.first;
+	});
+
+	output_->reserve(found.size());
+	for (auto& [order_, entity_] : found)
+		output_->push_back(entity_);
+}
+
+}	// namespace Zen
@@ -0,0 +1,281 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_GAMEOBJECTS_SPATIALINDEX_HPP
+#define ZEN_GAMEOBJECTS_SPATIALINDEX_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../ecs/entity.hpp"
+#include "../structs/list.hpp"
+#include "../geom/types/rectangle.hpp"
+#include "../components/spatial.hpp"
+
+namespace Zen {
+
+/**
+ * A hashed grid of the world bounds of the Game Objects of a Display List,
+ * so the cameras only look at the Game Objects around their view instead of
+ * the whole list.
+ *
+ * The index is only built on the first query, so nothing is maintained
+ * until a camera culls its view. From then on, the Display List adds and
+ * removes its Game Objects as they come and go, and a Game Object is only
+ * placed in the grid again after `MarkDirty` flagged it, which the setters of
+ * its position, size, scale, origin and rotation do.
+ *
+ * @since 0.0.0
+ */
+class SpatialIndex
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param list The Display List to index.
+	 */
+	SpatialIndex (const List<Entity>* list);
+
+	/**
+	 * @since 0.0.0
+	 */
+	~SpatialIndex ();
+
+	// The Game Objects point to the index they are in
+	SpatialIndex (const SpatialIndex&) = delete;
+	SpatialIndex& operator= (const SpatialIndex&) = delete;
+
+	/**
+	 * Empties the grid, and detaches the Game Objects from the index, which
+	 * is built again on the next query.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ();
+
+	/**
+	 * Adds a Game Object added to the Display List, to be placed in the grid
+	 * on the next update.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 */
+	void add (Entity entity);
+
+	/**
+	 * Removes a Game Object removed from the Display List.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 */
+	void remove (Entity entity);
+
+	/**
+	 * Places the Game Objects flagged as dirty in the grid again.
+	 *
+	 * This is called by the Camera Manager before rendering the cameras.
+	 *
+	 * @since 0.0.0
+	 */
+	void update ();
+
+	/**
+	 * Flags a Game Object to be placed in the grid again on the next update.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 */
+	void markDirty (Entity entity);
+
+	/**
+	 * Gets the Game Objects whose bounds intersect an area, along with the
+	 * ones the grid can't place. The first query builds the index.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param area The area, in world coordinates.
+	 * @param output The vector to fill with the Game Objects, in the order of
+	 * the Display List.
+	 */
+	void query (const Rectangle& area, std::vector<Entity>* output);
+
+	/**
+	 * The size of the cells of the grid, in world units.
+	 *
+	 * @since 0.0.0
+	 */
+	double cellSize = 256.;
+
+	/**
+	 * The number of cells a Game Object may span before it is stored aside.
+	 *
+	 * @since 0.0.0
+	 */
+	static const int MAX_CELLS = 64;
+
+private:
+	/**
+	 * Adds every Game Object of the Display List, and places them in the
+	 * grid.
+	 *
+	 * @since 0.0.0
+	 */
+	void build ();
+
+	/**
+	 * Updates the order of the Game Objects after the Display List changed,
+	 * adding the ones added to it without the callback.
+	 *
+	 * @since 0.0.0
+	 */
+	void updateOrder ();
+
+	/**
+	 * Creates the component of a Game Object, and stores it aside until the
+	 * next update places it in the grid.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 *
+	 * @return The component.
+	 */
+	Components::Spatial* insert (Entity entity);
+
+	/**
+	 * Removes a Game Object from the grid when its `Spatial` component goes,
+	 * including when it is destroyed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param registry The registry of the Game Object.
+	 * @param entity The Game Object.
+	 */
+	static void onDestroy (entt::registry& registry, Entity entity);
+
+	/**
+	 * Gets the component of a Game Object, if it is still in this index.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 *
+	 * @return The component, or `nullptr`.
+	 */
+	Components::Spatial* getSpatial (Entity entity);
+
+	/**
+	 * Computes the world bounds of a Game Object, and the cells they span.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 * @param spatial Its component.
+	 *
+	 * @return `false` if the Game Object can't be placed in the grid.
+	 */
+	bool computeBounds (Entity entity, Components::Spatial* spatial);
+
+	/**
+	 * Removes a Game Object from the cells, or the unbounded list, it is in.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 * @param spatial Its component.
+	 */
+	void unlink (Entity entity, Components::Spatial* spatial);
+
+	/**
+	 * Adds a Game Object to the cells, or the unbounded list, of its
+	 * component.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 * @param spatial Its component.
+	 */
+	void link (Entity entity, Components::Spatial* spatial);
+
+	/**
+	 * Gets the key of a cell in the grid.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param x The column of the cell.
+	 * @param y The row of the cell.
+	 *
+	 * @return The key.
+	 */
+	static std::uint64_t getKey (int x, int y);
+
+	/**
+	 * The Display List indexed.
+	 *
+	 * @since 0.0.0
+	 */
+	const List<Entity>* list;
+
+	/**
+	 * The version of the Display List the order was last updated for.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t listVersion = 0;
+
+	/**
+	 * Has the index been built, by a query?
+	 *
+	 * @since 0.0.0
+	 */
+	bool enabled = false;
+
+	/**
+	 * The Game Objects of each non-empty cell.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<std::uint64_t, std::vector<Entity>> cells;
+
+	/**
+	 * The Game Objects returned by every query.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> unbounded;
+
+	/**
+	 * The Game Objects to place in the grid again.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Entity> dirty;
+
+	/**
+	 * The current query, to return each Game Object once.
+	 *
+	 * @since 0.0.0
+	 */
+	std::uint32_t stamp = 0;
+
+	/**
+	 * The order and the Game Objects found by the current query, to sort
+	 * them.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::pair<std::size_t, Entity>> found;
+};
+
+}	// namespace Zen
+
+#endif
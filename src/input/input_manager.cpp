@@ -385,7 +385,7 @@ bool InputManager::inputCandidate (Entity entity_, Entity camera_)
 	return visible_;
 }
 
-std::vector<Entity> InputManager::hitTest (Pointer* pointer_, std::vector<Entity> gameObjects_, Entity camera_)
+std::span<Entity> InputManager::hitTest (Pointer* pointer_, std::span<const Entity> gameObjects_, Entity camera_)
 {
 	tempHitTest.clear();
 	auto& output_ = tempHitTest;
@@ -12,6 +12,7 @@
 #include "pointer.hpp"
 #include <SDL2/SDL_mouse.h>
 #include <SDL2/SDL_stdinc.h>
+#include <span>
 #include "../math/types/vector2.hpp"
 #include "../components/transform_matrix.hpp"
 #include "types/event.hpp"
@@ -201,7 +202,7 @@ public:
 
 	bool inputCandidate (Entity entity_, Entity camera_);
 
-	std::vector<Entity> hitTest (Pointer* pointer_, std::vector<Entity> gameObject_, Entity camera_);
+	std::span<Entity> hitTest (Pointer* pointer_, std::span<const Entity> gameObject_, Entity camera_);
 
 	bool pointWithinHitArea (Entity gameObject_, double x_, double y_);
 
@@ -407,7 +407,7 @@ std::vector<Entity> InputPlugin::hitTestPointer (Pointer *pointer_)
 		{
 			pointer_->camera = c_;
 
-			return over_;
+			return {over_.begin(), over_.end()};
 		}
 	}
 
@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "command_log.hpp"
+
+#include <sstream>
+#include "../utils/hash/fnv1a.hpp"
+
+namespace Zen {
+
+void CommandLog::clear ()
+{
+	commands.clear();
+	payloads.clear();
+}
+
+void CommandLog::recordDraw (const std::string& name_, GLenum topology_,
+		int first_, int count_, const void *payload_, std::size_t size_)
+{
+	RenderCommand &command_ = commands.emplace_back();
+	command_.type = RENDER_COMMAND::DRAW;
+	command_.name = name_;
+	command_.values = {topology_, first_, count_, 0};
+
+	if (payload_ && size_) {
+		auto *bytes_ = static_cast<const std::uint8_t*>(payload_);
+
+		command_.payloadOffset = payloads.size();
+		command_.payloadSize = size_;
+
+		payloads.insert(payloads.end(), bytes_, bytes_ + size_);
+	}
+}
+
+void CommandLog::recordClear (GLbitfield mask_)
+{
+	RenderCommand &command_ = commands.emplace_back();
+	command_.type = RENDER_COMMAND::CLEAR;
+	command_.values = {mask_, 0, 0, 0};
+}
+
+void CommandLog::recordState (const char *name_,
+		std::array<std::int64_t, 4> values_)
+{
+	RenderCommand &command_ = commands.emplace_back();
+	command_.type = RENDER_COMMAND::STATE;
+	command_.name = name_;
+	command_.values = values_;
+}
+
+void CommandLog::recordPresent ()
+{
+	commands.emplace_back().type = RENDER_COMMAND::PRESENT;
+}
+
+std::span<const std::uint8_t> CommandLog::getPayload (
+		const RenderCommand& command_) const
+{
+	if (!command_.payloadSize)
+		return {};
+
+	return {payloads.data() + command_.payloadOffset, command_.payloadSize};
+}
+
+int CommandLog::count (RENDER_COMMAND type_) const
+{
+	int count_ = 0;
+
+	for (auto &command_ : commands)
+		count_ += (command_.type == type_);
+
+	return count_;
+}
+
+std::uint64_t CommandLog::getHash () const
+{
+	std::uint64_t hash_ = FNV1A_OFFSET;
+
+	for (auto &command_ : commands) {
+		hash_ = Fnv1a(&command_.type, sizeof(command_.type), hash_);
+		hash_ = Fnv1a(command_.name.data(), command_.name.size() + 1, hash_);
+		hash_ = Fnv1a(command_.values.data(), sizeof(command_.values), hash_);
+	}
+
+	return Fnv1a(payloads.data(), payloads.size(), hash_);
+}
+
+std::string CommandLog::toString () const
+{
+	std::ostringstream out_;
+
+	for (auto &command_ : commands) {
+		auto &v_ = command_.values;
+
+		switch (command_.type) {
+			case RENDER_COMMAND::DRAW: {
+				auto payload_ = getPayload(command_);
+
+				out_ << "draw " << command_.name << " " << v_[0] << " " << v_[1]
+					<< " " << v_[2] << " " << payload_.size() << " " << std::hex
+					<< Fnv1a(payload_.data(), payload_.size()) << std::dec;
+				break;
+			}
+
+			case RENDER_COMMAND::CLEAR:
+				out_ << "clear " << v_[0];
+				break;
+
+			case RENDER_COMMAND::STATE:
+				out_ << "state " << command_.name << " " << v_[0] << " " << v_[1]
+					<< " " << v_[2] << " " << v_[3];
+				break;
+
+			case RENDER_COMMAND::PRESENT:
+				out_ << "present";
+				break;
+		}
+
+		out_ << "\n";
+	}
+
+	return out_.str();
+}
+
+}	// namespace Zen
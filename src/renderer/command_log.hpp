@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_COMMAND_LOG_HPP
+#define ZEN_RENDERER_COMMAND_LOG_HPP
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include <GL/glew.h>
+#include "../enums/render_command.hpp"
+
+namespace Zen {
+
+/**
+ * A command recorded instead of being sent to OpenGL.
+ *
+ * @struct RenderCommand
+ * @since 0.0.0
+ */
+struct RenderCommand
+{
+	/**
+	 * The kind of command.
+	 *
+	 * @since 0.0.0
+	 */
+	RENDER_COMMAND type = RENDER_COMMAND::DRAW;
+
+	/**
+	 * The pipeline that drew, or the state that changed.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string name;
+
+	/**
+	 * The arguments of the command, see `RENDER_COMMAND`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::array<std::int64_t, 4> values {0, 0, 0, 0};
+
+	/**
+	 * The offset of the vertex payload in `CommandLog::payloads`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t payloadOffset = 0;
+
+	/**
+	 * The size of the vertex payload in bytes, 0 if there is none.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t payloadSize = 0;
+};
+
+/**
+ * The commands of a frame rendered with the `RENDER_BACKEND::RECORD`
+ * backend, in the order they were issued.
+ *
+ * Two runs of the same scene give the same log, so its hash or its text can
+ * be compared to catch batching regressions without a GPU.
+ *
+ * @since 0.0.0
+ */
+class CommandLog
+{
+public:
+	/**
+	 * Removes all the commands, at the start of a frame.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ();
+
+	/**
+	 * Records a draw call.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param name The name of the pipeline drawing.
+	 * @param topology The primitive drawn.
+	 * @param first The first vertex.
+	 * @param count The number of vertices.
+	 * @param payload The vertices uploaded for the draw, if any.
+	 * @param size The size of the payload in bytes.
+	 */
+	void recordDraw (const std::string& name, GLenum topology, int first,
+			int count, const void *payload = nullptr, std::size_t size = 0);
+
+	/**
+	 * Records a clear.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param mask The buffers cleared.
+	 */
+	void recordClear (GLbitfield mask);
+
+	/**
+	 * Records a change of state.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param name The state that changed.
+	 * @param values The new values.
+	 */
+	void recordState (const char *name, std::array<std::int64_t, 4> values);
+
+	/**
+	 * Records the end of the frame.
+	 *
+	 * @since 0.0.0
+	 */
+	void recordPresent ();
+
+	/**
+	 * Gets the vertex payload of a command.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param command A command of this log.
+	 *
+	 * @return The bytes of the payload.
+	 */
+	std::span<const std::uint8_t> getPayload (
+			const RenderCommand& command) const;
+
+	/**
+	 * Gets the number of commands of the given kind.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param type The kind of command.
+	 *
+	 * @return The number of commands.
+	 */
+	int count (RENDER_COMMAND type) const;
+
+	/**
+	 * Hashes the whole log, payloads included.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The hash.
+	 */
+	std::uint64_t getHash () const;
+
+	/**
+	 * Writes the log as text, one command per line. The payloads are
+	 * written as their size and hash.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The text.
+	 */
+	std::string toString () const;
+
+	/**
+	 * The recorded commands.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<RenderCommand> commands;
+
+	/**
+	 * The vertex payloads of all the draw calls, one after the other.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::uint8_t> payloads;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,30 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_EVENTS_GPU_TIMINGS_HPP
+#define ZEN_RENDERER_EVENTS_GPU_TIMINGS_HPP
+
+#include <string>
+
+namespace Zen {
+namespace Events {
+
+/**
+ * The GPU Timings Event.
+ *
+ * This event is dispatched by the Renderer, when the `gpuTimers` option is
+ * set, as soon as the GPU timings of a past frame are available. Listeners
+ * receive a `const GpuTimingReport*`.
+ *
+ * @since 0.0.0
+ */
+const std::string RENDER_GPU_TIMINGS = "gpu-timings";
+
+}	// namespace Events
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,30 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_EVENTS_RENDER_STATS_HPP
+#define ZEN_RENDERER_EVENTS_RENDER_STATS_HPP
+
+#include <string>
+
+namespace Zen {
+namespace Events {
+
+/**
+ * The Render Stats Event.
+ *
+ * This event is dispatched by the Renderer at the end of every frame, right
+ * before the `post-render` event, once the stats of the frame are complete.
+ * Listeners receive a `const RenderStats*`.
+ *
+ * @since 0.0.0
+ */
+const std::string RENDER_STATS = "render-stats";
+
+}	// namespace Events
+}	// namespace Zen
+
+#endif
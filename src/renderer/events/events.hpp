@@ -12,5 +12,7 @@
 #include "POST_RENDER.hpp"
 #include "PRE_RENDER.hpp"
 #include "RESIZE.hpp"
+#include "GPU_TIMINGS.hpp"
+#include "RENDER_STATS.hpp"
 
 #endif
@@ -0,0 +1,320 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "frame_recorder.hpp"
+
+#include <cstring>
+#include "renderer.hpp"
+#include "../utils/messages.hpp"
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace Zen {
+
+extern Renderer g_renderer;
+
+FrameRecorder::~FrameRecorder ()
+{
+	// Only closes the stream, the OpenGL objects are released by `destroy`
+	if (recording)
+		stop();
+}
+
+void FrameRecorder::destroy ()
+{
+	stop();
+
+	deleteBuffers();
+}
+
+void FrameRecorder::deleteBuffers ()
+{
+	for (auto buffer_ : allBuffers)
+		g_renderer.state.deleteBuffer(buffer_);
+
+	if (!allBuffers.empty())
+		glDeleteBuffers(allBuffers.size(), allBuffers.data());
+
+	allBuffers.clear();
+	buffers.clear();
+}
+
+bool FrameRecorder::start (const std::string& path_, int fps_, int width_,
+		int height_)
+{
+	if (recording)
+		stop();
+
+	if (fps_ <= 0 || width_ <= 0 || height_ <= 0)
+		return false;
+
+	pipe = (!path_.empty() && path_[0] == '|');
+
+	if (pipe)
+		file = popen(path_.c_str() + 1, "w");
+	else
+		file = std::fopen(path_.c_str(), "wb");
+
+	if (!file) {
+		MessageError("Failed to open the recording stream: ", path_);
+		return false;
+	}
+
+	y4m = (path_.size() > 4 && path_.compare(path_.size() - 4, 4, ".y4m") == 0);
+
+	width = width_;
+	height = height_;
+
+	// The buffers of a previous recording are too small or too large
+	GLsizeiptr bufferSize_ = static_cast<GLsizeiptr>(width) * height * 4;
+
+	if (bufferSize != bufferSize_) {
+		deleteBuffers();
+		bufferSize = bufferSize_;
+	}
+
+	if (y4m)
+		std::fprintf(file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", width,
+				height, fps_);
+
+	interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+			std::chrono::duration<double>(1. / fps_));
+	nextFrame = std::chrono::steady_clock::now();
+
+	written = 0;
+	dropped = 0;
+
+	stopping = false;
+	thread = std::thread(&FrameRecorder::work, this);
+
+	recording = true;
+
+	return true;
+}
+
+void FrameRecorder::stop ()
+{
+	if (!recording)
+		return;
+
+	// Keep the frames already read
+	while (!pending.empty()) {
+		glClientWaitSync(pending.front().fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+				GL_TIMEOUT_IGNORED);
+
+		collect(pending.front(), true);
+		pending.pop_front();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_ (mutex);
+		stopping = true;
+	}
+
+	wake.notify_all();
+	thread.join();
+
+	if (pipe)
+		pclose(file);
+	else
+		std::fclose(file);
+
+	file = nullptr;
+	recording = false;
+}
+
+void FrameRecorder::capture ()
+{
+	if (!recording)
+		return;
+
+	// The fences signal in order
+	while (!pending.empty()) {
+		GLenum status_ = glClientWaitSync(pending.front().fence, 0, 0);
+
+		if (status_ != GL_ALREADY_SIGNALED
+				&& status_ != GL_CONDITION_SATISFIED)
+			break;
+
+		collect(pending.front());
+		pending.pop_front();
+	}
+
+	auto now_ = std::chrono::steady_clock::now();
+
+	if (now_ < nextFrame)
+		return;
+
+	// Don't try to catch up on the missed frames
+	nextFrame += interval;
+	if (nextFrame < now_)
+		nextFrame = now_ + interval;
+
+	// The GPU is behind
+	if (pending.size() >= MAX_READBACKS) {
+		dropped++;
+
+		return;
+	}
+
+	GLuint buffer_;
+
+	if (buffers.empty()) {
+		glGenBuffers(1, &buffer_);
+		allBuffers.push_back(buffer_);
+
+		g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, buffer_);
+		glBufferData(GL_PIXEL_PACK_BUFFER, bufferSize, nullptr,
+				GL_STREAM_READ);
+	}
+	else {
+		buffer_ = buffers.back();
+		buffers.pop_back();
+
+		g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, buffer_);
+	}
+
+	g_renderer.state.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+	pending.push_back({buffer_, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)});
+
+	// Don't let the other reads land in the buffer
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FrameRecorder::collect (Readback& readback_, bool wait_)
+{
+	glDeleteSync(readback_.fence);
+
+	std::vector<std::uint8_t> frame_;
+	bool full_;
+
+	{
+		std::unique_lock<std::mutex> lock_ (mutex);
+
+		if (wait_)
+			taken.wait(lock_, [this] { return queue.size() < MAX_QUEUED; });
+
+		full_ = (queue.size() >= MAX_QUEUED);
+
+		if (!full_ && !frames.empty()) {
+			frame_ = std::move(frames.back());
+			frames.pop_back();
+		}
+	}
+
+	const size_t size_ = static_cast<size_t>(width) * height * 4;
+
+	// The writer is behind
+	if (full_) {
+		buffers.push_back(readback_.buffer);
+		dropped++;
+
+		return;
+	}
+
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, readback_.buffer);
+
+	const void *pixels_ = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size_,
+			GL_MAP_READ_BIT);
+
+	if (pixels_) {
+		frame_.resize(size_);
+		std::memcpy(frame_.data(), pixels_, size_);
+
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	buffers.push_back(readback_.buffer);
+
+	if (!pixels_) {
+		dropped++;
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_ (mutex);
+		queue.push_back(std::move(frame_));
+	}
+
+	wake.notify_one();
+}
+
+void FrameRecorder::work ()
+{
+	std::unique_lock<std::mutex> lock_ (mutex);
+
+	while (true) {
+		wake.wait(lock_, [this] { return stopping || !queue.empty(); });
+
+		if (queue.empty())
+			return;
+
+		std::vector<std::uint8_t> frame_ = std::move(queue.front());
+		queue.pop_front();
+
+		taken.notify_all();
+
+		lock_.unlock();
+
+		write(frame_);
+		written++;
+
+		lock_.lock();
+
+		frames.push_back(std::move(frame_));
+	}
+}
+
+void FrameRecorder::write (const std::vector<std::uint8_t>& frame_)
+{
+	const size_t pitch_ = static_cast<size_t>(width) * 4;
+
+	if (!y4m) {
+		// OpenGL rows go bottom up
+		for (int i = height - 1; i >= 0; i--)
+			std::fwrite(frame_.data() + i * pitch_, 1, pitch_, file);
+
+		return;
+	}
+
+	// BT.601 limited range, one plane after another
+	static thread_local std::vector<std::uint8_t> planes_;
+	const size_t area_ = static_cast<size_t>(width) * height;
+	planes_.resize(area_ * 3);
+
+	std::uint8_t *y_ = planes_.data();
+	std::uint8_t *u_ = y_ + area_;
+	std::uint8_t *v_ = u_ + area_;
+
+	for (int row_ = 0; row_ < height; row_++) {
+		const std::uint8_t *src_ = frame_.data() + (height - 1 - row_) * pitch_;
+		size_t dst_ = static_cast<size_t>(row_) * width;
+
+		for (int x_ = 0; x_ < width; x_++, src_ += 4, dst_++) {
+			int r_ = src_[0], g_ = src_[1], b_ = src_[2];
+
+			y_[dst_] = ((66 * r_ + 129 * g_ + 25 * b_ + 128) >> 8) + 16;
+			u_[dst_] = ((-38 * r_ - 74 * g_ + 112 * b_ + 128) >> 8) + 128;
+			v_[dst_] = ((112 * r_ - 94 * g_ - 18 * b_ + 128) >> 8) + 128;
+		}
+	}
+
+	std::fputs("FRAME\n", file);
+	std::fwrite(planes_.data(), 1, planes_.size(), file);
+}
+
+}	// namespace Zen
@@ -0,0 +1,293 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_FRAME_RECORDER_HPP
+#define ZEN_RENDERER_FRAME_RECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <GL/glew.h>
+
+namespace Zen {
+
+/**
+ * Streams the rendered frames into a video file or a pipe.
+ *
+ * The frames are read back through a ring of pixel buffer objects, and handed
+ * to a writer thread through a bounded queue. Nothing ever waits on the GPU
+ * or on the writer: when either falls behind, the frame is dropped and
+ * counted in `dropped`.
+ *
+ * A path ending in `.y4m` is written as a YUV4MPEG2 stream (4:4:4), that
+ * most video tools read. Any other path gets the raw RGBA frames, top row
+ * first. A path starting with `|` is run as a command, which receives the
+ * stream on its standard input.
+ *
+ * @since 0.0.0
+ */
+class FrameRecorder
+{
+public:
+	~FrameRecorder ();
+
+	/**
+	 * Starts recording.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path The path of the file, or `|` followed by a command.
+	 * @param fps The number of frames to record per second.
+	 * @param width The width of the frames.
+	 * @param height The height of the frames.
+	 *
+	 * @return `true` if the recording started.
+	 */
+	bool start (const std::string& path, int fps, int width, int height);
+
+	/**
+	 * Stops recording, once the frames in flight are written, and closes the
+	 * stream.
+	 *
+	 * @since 0.0.0
+	 */
+	void stop ();
+
+	/**
+	 * Stops the recording, if any, and deletes the pixel buffers. Called by
+	 * the Renderer while the OpenGL context is still alive.
+	 *
+	 * @since 0.0.0
+	 */
+	void destroy ();
+
+	/**
+	 * Collects the frames the GPU is done with, and reads the current frame
+	 * if one is due. Called by the Renderer before the buffers are swapped.
+	 *
+	 * @since 0.0.0
+	 */
+	void capture ();
+
+	/**
+	 * Is a recording running?
+	 *
+	 * @since 0.0.0
+	 */
+	bool recording = false;
+
+	/**
+	 * The number of frames written in the current recording.
+	 *
+	 * @since 0.0.0
+	 */
+	std::atomic<int> written {0};
+
+	/**
+	 * The number of frames dropped in the current recording, because the GPU
+	 * or the writer fell behind.
+	 *
+	 * @since 0.0.0
+	 */
+	std::atomic<int> dropped {0};
+
+	/**
+	 * The maximum number of frames read back by the GPU at once.
+	 *
+	 * @since 0.0.0
+	 */
+	static const size_t MAX_READBACKS = 3;
+
+	/**
+	 * The maximum number of frames waiting for the writer.
+	 *
+	 * @since 0.0.0
+	 */
+	static const size_t MAX_QUEUED = 8;
+
+private:
+	/**
+	 * A frame being read by the GPU.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Readback
+	{
+		GLuint buffer;
+		GLsync fence;
+	};
+
+	/**
+	 * Copies a finished readback into the queue of the writer, unless it is
+	 * full.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param readback The readback.
+	 * @param wait Wait for room in the queue instead of dropping the frame.
+	 */
+	void collect (Readback& readback, bool wait = false);
+
+	/**
+	 * Deletes the pixel buffers, which mustn't be in flight.
+	 *
+	 * @since 0.0.0
+	 */
+	void deleteBuffers ();
+
+	/**
+	 * The loop of the writer thread.
+	 *
+	 * @since 0.0.0
+	 */
+	void work ();
+
+	/**
+	 * Writes a frame in the stream.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param frame The RGBA pixels of the frame, bottom row first.
+	 */
+	void write (const std::vector<std::uint8_t>& frame);
+
+	/**
+	 * The stream written to.
+	 *
+	 * @since 0.0.0
+	 */
+	std::FILE *file = nullptr;
+
+	/**
+	 * Is the stream a pipe to a command?
+	 *
+	 * @since 0.0.0
+	 */
+	bool pipe = false;
+
+	/**
+	 * Is the stream written as YUV4MPEG2?
+	 *
+	 * @since 0.0.0
+	 */
+	bool y4m = false;
+
+	/**
+	 * The size of the frames.
+	 *
+	 * @since 0.0.0
+	 */
+	int width = 0;
+
+	/**
+	 * @since 0.0.0
+	 */
+	int height = 0;
+
+	/**
+	 * The time between two recorded frames.
+	 *
+	 * @since 0.0.0
+	 */
+	std::chrono::steady_clock::duration interval;
+
+	/**
+	 * The time the next frame is due.
+	 *
+	 * @since 0.0.0
+	 */
+	std::chrono::steady_clock::time_point nextFrame;
+
+	/**
+	 * The frames being read by the GPU, oldest first.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<Readback> pending;
+
+	/**
+	 * The pixel buffers that are free to use.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLuint> buffers;
+
+	/**
+	 * All the pixel buffers created, to delete them.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLuint> allBuffers;
+
+	/**
+	 * The size of the pixel buffers, in bytes, which are all made for frames
+	 * of the same size.
+	 *
+	 * @since 0.0.0
+	 */
+	GLsizeiptr bufferSize = 0;
+
+	/**
+	 * The writer thread.
+	 *
+	 * @since 0.0.0
+	 */
+	std::thread thread;
+
+	/**
+	 * Guards `queue`, `frames` and `stopping`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::mutex mutex;
+
+	/**
+	 * Wakes the writer thread up.
+	 *
+	 * @since 0.0.0
+	 */
+	std::condition_variable wake;
+
+	/**
+	 * Signals that the writer took a frame.
+	 *
+	 * @since 0.0.0
+	 */
+	std::condition_variable taken;
+
+	/**
+	 * The frames waiting for the writer.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<std::vector<std::uint8_t>> queue;
+
+	/**
+	 * The frame storages that are free to use, so recording doesn't allocate.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::vector<std::uint8_t>> frames;
+
+	/**
+	 * Is the writer asked to stop once the queue is empty?
+	 *
+	 * @since 0.0.0
+	 */
+	bool stopping = false;
+};
+
+}	// namespace Zen
+
+#endif
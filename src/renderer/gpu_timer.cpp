@@ -0,0 +1,180 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "gpu_timer.hpp"
+
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+GpuTimer::~GpuTimer ()
+{
+	if (!allQueries.empty())
+		glDeleteQueries(allQueries.size(), allQueries.data());
+}
+
+bool GpuTimer::boot ()
+{
+	// Timestamp queries are core since OpenGL 3.3, but an implementation may
+	// still report a counter without any bit
+	GLint bits_ = 0;
+	glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits_);
+
+	if (bits_ == 0) {
+		MessageWarning("GPU timers are not supported, they are disabled.");
+
+		enabled = false;
+	}
+	else {
+		enabled = true;
+	}
+
+	return enabled;
+}
+
+GLuint GpuTimer::timestamp ()
+{
+	GLuint query_;
+
+	if (queries.empty()) {
+		glGenQueries(1, &query_);
+		allQueries.push_back(query_);
+	}
+	else {
+		query_ = queries.back();
+		queries.pop_back();
+	}
+
+	glQueryCounter(query_, GL_TIMESTAMP);
+
+	return query_;
+}
+
+GLuint64 GpuTimer::getResult (GLuint query_)
+{
+	GLuint64 result_ = 0;
+	glGetQueryObjectui64v(query_, GL_QUERY_RESULT, &result_);
+
+	queries.push_back(query_);
+
+	return result_;
+}
+
+bool GpuTimer::beginFrame ()
+{
+	if (!enabled)
+		return false;
+
+	if (recording)
+		endFrame();
+
+	bool collected_ = false;
+
+	// The queries complete in order, so a frame is ready once its last
+	// timestamp is
+	while (!pending.empty()) {
+		GLint available_ = 0;
+		glGetQueryObjectiv(pending.front().end, GL_QUERY_RESULT_AVAILABLE,
+				&available_);
+
+		if (!available_)
+			break;
+
+		collect(pending.front());
+		pending.pop_front();
+
+		collected_ = true;
+	}
+
+	recording = pending.size() < MAX_PENDING_FRAMES;
+
+	current.index = frameCount++;
+	current.samples.clear();
+
+	if (recording)
+		current.start = timestamp();
+
+	return collected_;
+}
+
+void GpuTimer::endFrame ()
+{
+	if (!enabled || !recording)
+		return;
+
+	current.end = timestamp();
+
+	pending.push_back(std::move(current));
+	current = Frame();
+
+	recording = false;
+}
+
+int GpuTimer::begin (GPU_TIMING type_, const std::string& name_,
+		Entity camera_)
+{
+	if (!enabled || !recording)
+		return -1;
+
+	current.samples.push_back({type_, name_, camera_, timestamp(), 0});
+
+	return current.samples.size() - 1;
+}
+
+void GpuTimer::end (int index_)
+{
+	if (index_ < 0 || !recording)
+		return;
+
+	current.samples[index_].end = timestamp();
+}
+
+void GpuTimer::collect (Frame& frame_)
+{
+	report.frame = frame_.index;
+	report.timings.clear();
+
+	GLuint64 start_ = getResult(frame_.start);
+	GLuint64 end_ = getResult(frame_.end);
+	report.total = (end_ - start_) / 1e6;
+
+	for (auto& sample_ : frame_.samples) {
+		GLuint64 sampleStart_ = getResult(sample_.start);
+
+		// A scope left open when the frame ended
+		if (!sample_.end)
+			continue;
+
+		double time_ = (getResult(sample_.end) - sampleStart_) / 1e6;
+
+		// Sum the measures of the same pipeline for the same camera
+		GpuTiming *timing_ = nullptr;
+		for (auto& t_ : report.timings) {
+			if (t_.type == sample_.type && t_.name == sample_.name &&
+					t_.camera == sample_.camera) {
+				timing_ = &t_;
+				break;
+			}
+		}
+
+		if (!timing_) {
+			report.timings.push_back({sample_.type, sample_.name,
+					sample_.camera, 0., 0});
+			timing_ = &report.timings.back();
+		}
+
+		timing_->time += time_;
+		timing_->count++;
+	}
+}
+
+const GpuTimingReport& GpuTimer::getReport () const
+{
+	return report;
+}
+
+}	// namespace Zen
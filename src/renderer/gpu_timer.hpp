@@ -0,0 +1,298 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_GPU_TIMER_HPP
+#define ZEN_RENDERER_GPU_TIMER_HPP
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <GL/glew.h>
+#include "../ecs/entity.hpp"
+#include "../enums/gpu_timing.hpp"
+
+namespace Zen {
+
+/**
+ * The GPU time spent on a pipeline, a camera or a post pipeline during a
+ * frame.
+ *
+ * @struct GpuTiming
+ * @since 0.0.0
+ */
+struct GpuTiming
+{
+	/**
+	 * What was measured.
+	 *
+	 * @since 0.0.0
+	 */
+	GPU_TIMING type = GPU_TIMING::FLUSH;
+
+	/**
+	 * The name of the pipeline, empty for a camera.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string name;
+
+	/**
+	 * The camera that was rendering.
+	 *
+	 * @since 0.0.0
+	 */
+	Entity camera = entt::null;
+
+	/**
+	 * The GPU time, in milliseconds.
+	 *
+	 * @since 0.0.0
+	 */
+	double time = 0.;
+
+	/**
+	 * The number of measures summed in `time`, such as the number of flushes
+	 * of a pipeline.
+	 *
+	 * @since 0.0.0
+	 */
+	int count = 0;
+};
+
+/**
+ * The GPU timings of a frame.
+ *
+ * @struct GpuTimingReport
+ * @since 0.0.0
+ */
+struct GpuTimingReport
+{
+	/**
+	 * The index of the frame the timings were measured in, or -1 if no frame
+	 * was measured yet.
+	 *
+	 * @since 0.0.0
+	 */
+	int frame = -1;
+
+	/**
+	 * The GPU time of the whole frame, in milliseconds.
+	 *
+	 * @since 0.0.0
+	 */
+	double total = 0.;
+
+	/**
+	 * The timings, in the order they were first measured.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GpuTiming> timings;
+};
+
+/**
+ * Measures the GPU time of the pipeline flushes, the cameras and the post
+ * pipelines with timestamp queries.
+ *
+ * The queries are only read a few frames later, once the GPU is done with
+ * them, so measuring never stalls the pipeline. Timestamps are used rather
+ * than `GL_TIME_ELAPSED` queries because the latter can't be nested, and the
+ * flushes happen inside the camera scopes.
+ *
+ * It is enabled with the `RenderConfig::gpuTimers` option.
+ *
+ * @since 0.0.0
+ */
+class GpuTimer
+{
+public:
+	~GpuTimer ();
+
+	/**
+	 * Enables the timer, if the timestamp queries are supported.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return `true` if the timer is enabled.
+	 */
+	bool boot ();
+
+	/**
+	 * Collects the timings of the past frames that are available, and starts
+	 * measuring a new frame.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return `true` if a new report is available.
+	 */
+	bool beginFrame ();
+
+	/**
+	 * Stops measuring the current frame.
+	 *
+	 * @since 0.0.0
+	 */
+	void endFrame ();
+
+	/**
+	 * Starts measuring a scope.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param type What is measured.
+	 * @param name The name of the pipeline, if any.
+	 * @param camera The camera that is rendering.
+	 *
+	 * @return The index of the measure, or -1 if nothing is measured.
+	 */
+	int begin (GPU_TIMING type, const std::string& name,
+			Entity camera = entt::null);
+
+	/**
+	 * Stops measuring a scope.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param index The index returned by `begin`.
+	 */
+	void end (int index);
+
+	/**
+	 * Gets the timings of the latest measured frame that is available.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The report.
+	 */
+	const GpuTimingReport& getReport () const;
+
+	/**
+	 * Is the timer measuring?
+	 *
+	 * @since 0.0.0
+	 */
+	bool enabled = false;
+
+	/**
+	 * The maximum number of frames waiting for their results. Frames are
+	 * skipped while this many are waiting.
+	 *
+	 * @since 0.0.0
+	 */
+	static const size_t MAX_PENDING_FRAMES = 4;
+
+private:
+	/**
+	 * A measure, between two timestamp queries.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Sample
+	{
+		GPU_TIMING type;
+		std::string name;
+		Entity camera;
+		GLuint start;
+		GLuint end;
+	};
+
+	/**
+	 * The measures of a frame.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Frame
+	{
+		int index = 0;
+		GLuint start = 0;
+		GLuint end = 0;
+		std::vector<Sample> samples;
+	};
+
+	/**
+	 * Gets a query from the pool and records a timestamp with it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The query.
+	 */
+	GLuint timestamp ();
+
+	/**
+	 * Reads the results of a frame into the report, and returns its queries
+	 * to the pool.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param frame The frame to read.
+	 */
+	void collect (Frame& frame);
+
+	/**
+	 * Gets the result of a timestamp query.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param query The query.
+	 *
+	 * @return The timestamp, in nanoseconds.
+	 */
+	GLuint64 getResult (GLuint query);
+
+	/**
+	 * The frames waiting for their results, oldest first.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<Frame> pending;
+
+	/**
+	 * The frame being measured.
+	 *
+	 * @since 0.0.0
+	 */
+	Frame current;
+
+	/**
+	 * Is the current frame measured?
+	 *
+	 * @since 0.0.0
+	 */
+	bool recording = false;
+
+	/**
+	 * The number of frames started.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameCount = 0;
+
+	/**
+	 * The queries that are free to use.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLuint> queries;
+
+	/**
+	 * All the queries created, to delete them.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLuint> allQueries;
+
+	/**
+	 * The latest report.
+	 *
+	 * @since 0.0.0
+	 */
+	GpuTimingReport report;
+};
+
+}	// namespace Zen
+
+#endif
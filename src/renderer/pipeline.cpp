@@ -8,6 +8,7 @@
 #include "pipeline.hpp"
 #include "renderer.hpp"
 #include "utility.hpp"
+#include "uniforms.hpp"
 #include "../scale/scale_manager.hpp"
 #include "../utils/map/emplace.hpp"
 #include "../texture/components/frame.hpp"
@@ -28,6 +29,7 @@ extern Window g_window;
 Pipeline::Pipeline (PipelineConfig config)
 	: name (config.name)
 	, topology (config.topology)
+	, indexedQuads (config.indexedQuads && config.topology == GL_TRIANGLES)
 	, forceZero (config.forceZero)
 	, config (config)
 {
@@ -35,8 +37,24 @@ Pipeline::Pipeline (PipelineConfig config)
 
 Pipeline::~Pipeline ()
 {
+	g_renderer.state.deleteVertexArray(vertexArray);
 	glDeleteVertexArrays(1, &vertexArray);
-	glDeleteBuffers(1, &vertexBuffer);
+
+	if (g_renderer.currentVertexArray == vertexArray)
+		g_renderer.currentVertexArray = 0;
+
+	if (vertexBuffers.empty())
+		vertexBuffers.emplace_back(vertexBuffer);
+
+	for (auto buffer : vertexBuffers)
+		g_renderer.state.deleteBuffer(buffer);
+
+	glDeleteBuffers(vertexBuffers.size(), vertexBuffers.data());
+
+	for (auto fence : streamFences) {
+		if (fence)
+			glDeleteSync(fence);
+	}
 
 	// Remove listeners
 	g_renderer.off(resizeListener);
@@ -74,9 +92,14 @@ void Pipeline::boot()
 
 	int batchSize = config.batchSize;
 
-	// * 6 because there are 6 vertices in a quad and 'batchSize' represents
-	// the quantity of quads in the batch
-	vertexCapacity = batchSize * 6;
+	// 'batchSize' represents the quantity of quads in the batch, a quad being
+	// 6 vertices, or only 4 if they are indexed
+	if (indexedQuads)
+		quadVertexCount = 4;
+	else if (config.instanced)
+		quadVertexCount = 1;
+
+	vertexCapacity = batchSize * quadVertexCount;
 
 	vertexData.resize(vertexCapacity * vertexSize);
 
@@ -87,8 +110,45 @@ void Pipeline::boot()
 		vertexBuffer = g_renderer.createVertexBuffer(vertexData, GL_STATIC_DRAW);
 	}
 	else {
-		vertexBuffer = g_renderer.createVertexBuffer(sizeof(std::uint8_t) *
-				vertexData.size(), GL_DYNAMIC_DRAW);
+		streaming = config.streaming;
+
+		// Instanced attributes can't be offset by the draw call without
+		// `baseInstance`, so mapped regions fall back to orphaning
+		if (config.instanced
+				&& streaming == BUFFER_STREAMING::MAP_UNSYNCHRONIZED)
+			streaming = BUFFER_STREAMING::ORPHAN;
+
+		int count_ = std::max(1, config.streamingBuffers);
+		size_t size_ = sizeof(std::uint8_t) * vertexData.size();
+
+		switch (streaming) {
+			case BUFFER_STREAMING::ROUND_ROBIN:
+				for (int i = 0; i < count_; i++) {
+					vertexBuffers.emplace_back(
+						g_renderer.createVertexBuffer(size_, GL_STREAM_DRAW)
+					);
+				}
+				vertexBuffer = vertexBuffers[0];
+				g_renderer.state.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+				break;
+
+			case BUFFER_STREAMING::MAP_UNSYNCHRONIZED:
+				// A single buffer holding a region for each batch in flight
+				vertexBuffer = g_renderer.createVertexBuffer(size_ * count_,
+						GL_STREAM_DRAW);
+				streamFences.resize(count_, nullptr);
+				break;
+
+			case BUFFER_STREAMING::ORPHAN:
+				vertexBuffer = g_renderer.createVertexBuffer(size_,
+						GL_STREAM_DRAW);
+				break;
+
+			default:
+				vertexBuffer = g_renderer.createVertexBuffer(size_,
+						GL_DYNAMIC_DRAW);
+				break;
+		}
 	}
 
 	// Setup shaders
@@ -96,12 +156,19 @@ void Pipeline::boot()
 		shader.second->rebind();
 	}
 
+	// The element array binding is part of the vertex array state, so it only
+	// needs to be bound once here
+	if (indexedQuads) {
+		indexBuffer = g_renderer.getQuadIndexBuffer(batchSize);
+		g_renderer.state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	}
+
 	unsetVertexArray();
 
 	hasBooted = true;
 
 	resizeListener = g_renderer.on("resize", &Pipeline::resize, this);
-	preRenderListener = g_renderer.on("pre-render", &Pipeline::onPreRender, this);
+	preRenderListener = g_renderer.on("pre-render", &Pipeline::preRender, this);
 	renderListener = g_renderer.on("render", &Pipeline::onRender, this);
 	postRenderListener = g_renderer.on("post-render", &Pipeline::onPostRender, this);
 
@@ -121,6 +188,7 @@ void Pipeline::setShader (Shader *shader, bool setAttributes)
 {
 	if (shader != currentShader || g_renderer.currentProgram
 			!= currentShader->program) {
+		g_renderer.stats.flushReason = FLUSH_REASON::PIPELINE;
 		flush();
 
 		g_renderer.resetTextures();
@@ -156,9 +224,13 @@ void Pipeline::setShadersFromConfig (PipelineConfig config)
 	shaders.clear();
 	std::string first;
 
+	int arrayUnits = g_renderer.textureArrays.units;
+	textureArrays = (arrayUnits > 0
+			&& config.fragShader.find("%arrayselect%") != std::string::npos);
+
 	std::string defaultVertShader = config.vertShader;
 	std::string defaultFragShader = ParseFragmentShaderMaxTextures(
-			config.fragShader, g_renderer.maxTextures);
+			config.fragShader, g_renderer.maxTextures, arrayUnits);
 	auto defaultAttribs = config.attributes;
 
 	auto configShaders = config.shaders;
@@ -182,7 +254,7 @@ void Pipeline::setShadersFromConfig (PipelineConfig config)
 
 			std::string name = entry.name;
 			std::string vertShader = entry.vertShader;
-			std::string fragShader = ParseFragmentShaderMaxTextures(entry.vertShader, g_renderer.maxTextures);
+			std::string fragShader = ParseFragmentShaderMaxTextures(entry.vertShader, g_renderer.maxTextures, arrayUnits);
 			auto attributes = entry.attributes;
 
 			if (!vertShader.empty() && !fragShader.empty()) {
@@ -217,7 +289,13 @@ int Pipeline::setGameObject (Entity gameObject)
 
 bool Pipeline::shouldFlush (int amount)
 {
-	return (vertexCount + amount > vertexCapacity);
+	if (vertexCount + amount > vertexCapacity) {
+		g_renderer.stats.flushReason = FLUSH_REASON::BATCH_FULL;
+
+		return true;
+	}
+
+	return false;
 }
 
 
@@ -242,23 +320,28 @@ void Pipeline::resize (int width_, int height_)
 	onResize(width, height);
 }
 
-void Pipeline::setProjectionMatrix (int width_, int height_)
+void Pipeline::setProjectionMatrix (int width_, int height_, bool flipY_)
 {
 	projectionWidth = width_;
 	projectionHeight = height_;
+	projectionFlipY = flipY_;
 
-	projectionMatrix = glm::ortho(0.f, (float)width_, (float)height_, 0.f);
+	if (flipY_)
+		projectionMatrix = glm::ortho(0.f, (float)width_, 0.f, (float)height_);
+	else
+		projectionMatrix = glm::ortho(0.f, (float)width_, (float)height_, 0.f);
 
-	std::string name = "uProjectionMatrix";
+	// Every vertex lands on the depth of the Renderer, whatever its z
+	projectionDepth = g_renderer.depth;
+	projectionMatrix[2][2] = 0.f;
+	projectionMatrix[3][2] = projectionDepth;
 
 	for (auto &s : shaders) {
 		auto &shader = s.second;
 
-		if (shader->hasUniform(name)) {
-			shader->resetUniform(name);
-
-			shader->set(name, false, projectionMatrix);
-		}
+		// Force the upload, as the cached value may be stale
+		shader->resetUniform(Uniforms::PROJECTION_MATRIX);
+		shader->set(Uniforms::PROJECTION_MATRIX, false, projectionMatrix);
 	}
 }
 
@@ -266,9 +349,19 @@ void Pipeline::updateProjectionMatrix ()
 {
 	double globalWidth_ = g_scale.gameSize.width;//g_renderer.projectionWidth;
 	double globalHeight_ = g_scale.gameSize.height;//g_renderer.projectionHeight;
+	bool flipY_ = false;
+
+	// Render Textures are drawn right side up, so they sample like images
+	if (!g_renderer.renderTextureStack.empty()) {
+		globalWidth_ = g_renderer.renderTextureStack.back()[0];
+		globalHeight_ = g_renderer.renderTextureStack.back()[1];
+		flipY_ = true;
+	}
 
-	if (projectionWidth != globalWidth_ || projectionHeight != globalHeight_)
-		setProjectionMatrix(globalWidth_, globalHeight_);
+	if (projectionWidth != globalWidth_ || projectionHeight != globalHeight_
+			|| projectionFlipY != flipY_
+			|| projectionDepth != g_renderer.depth)
+		setProjectionMatrix(globalWidth_, globalHeight_, flipY_);
 }
 
 void Pipeline::bind (Shader *currentShader_)
@@ -309,16 +402,7 @@ void Pipeline::rebind ()
 
 bool Pipeline::setVertexBuffer ()
 {
-	GLint buffer_;
-	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &buffer_);
-
-	if (buffer_ != vertexBuffer) {
-		glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-
-		return true;
-	}
-
-	return false;
+	return g_renderer.state.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
 }
 
 bool Pipeline::setVertexArray ()
@@ -327,7 +411,7 @@ bool Pipeline::setVertexArray ()
 
 	if (vao_ != vertexArray) {
 		g_renderer.currentVertexArray = vertexArray;
-		glBindVertexArray(vertexArray);
+		g_renderer.state.bindVertexArray(vertexArray);
 		setVertexBuffer();
 		return true;
 	}
@@ -343,12 +427,12 @@ bool Pipeline::unsetVertexArray ()
 
 	if (vao_ != 0) {
 		g_renderer.currentVertexArray = 0;
-		glBindVertexArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		g_renderer.state.bindVertexArray(0);
+		g_renderer.state.bindBuffer(GL_ARRAY_BUFFER, 0);
 		return true;
 	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	g_renderer.state.bindBuffer(GL_ARRAY_BUFFER, 0);
 
 	return false;
 }
@@ -363,8 +447,12 @@ void Pipeline::preBatch (Entity entity)
 
 void Pipeline::postBatch (Entity entity)
 {
+	int timing_ = g_renderer.gpuTimer.begin(GPU_TIMING::POSTFX, name, entity);
+
 	onDraw(currentRenderTarget);
 
+	g_renderer.gpuTimer.end(timing_);
+
 	onPostBatch(entity);
 }
 
@@ -388,32 +476,140 @@ void Pipeline::flush (bool isPostFlush_)
 
 		onBeforeFlush(isPostFlush_);
 
-		// Get size of a single vertex
-		int vertexSize_ = currentShader->vertexSize;
+		Uint64 start_ = SDL_GetPerformanceCounter();
+
+		if (active && g_renderer.recordCommands) {
+			// The batch is kept in the log instead of being uploaded
+			g_renderer.commands.recordDraw(name, topology, 0, vertexCount,
+					vertexData.data(), vertexCount * currentShader->vertexSize);
+
+			g_renderer.stats.addFlush(name,
+					config.instanced ? vertexCount * 6 : vertexCount);
+		}
+		else if (active) {
+			int timing_ = g_renderer.gpuTimer.begin(GPU_TIMING::FLUSH, name,
+					g_renderer.pipelines.timedCamera);
 
-		if (active) {
 			setVertexArray();
 
-			if (vertexCount == vertexCapacity)
-				glBufferData(GL_ARRAY_BUFFER, vertexCount * vertexSize_,
-						vertexData.data(), GL_DYNAMIC_DRAW);
+			int first_ = streamVertices();
+
+			if (config.instanced)
+				glDrawArraysInstanced(topology, 0, 6, vertexCount);
+			else if (indexedQuads)
+				glDrawElementsBaseVertex(topology, (vertexCount / 4) * 6,
+						GL_UNSIGNED_INT, nullptr, first_);
 			else
-				glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * vertexSize_,
-						vertexData.data());
+				glDrawArrays(topology, first_, vertexCount);
 
-			glDrawArrays(topology, 0, vertexCount);
+			if (streaming == BUFFER_STREAMING::ROUND_ROBIN) {
+				streamIndex = (streamIndex + 1) % vertexBuffers.size();
+			}
+			else if (streaming == BUFFER_STREAMING::MAP_UNSYNCHRONIZED) {
+				streamFences[streamIndex] = glFenceSync(
+						GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				streamIndex = (streamIndex + 1) % streamFences.size();
+			}
 
 			unsetVertexArray();
+
+			g_renderer.gpuTimer.end(timing_);
+
+			g_renderer.stats.addFlush(name,
+					config.instanced ? vertexCount * 6 : vertexCount);
 		}
 
+		lastFlushTime = (SDL_GetPerformanceCounter() - start_) * 1000.
+			/ SDL_GetPerformanceFrequency();
+		frameFlushTime += lastFlushTime;
+		frameFlushCount++;
+
 		vertexCount = 0;
 
 		emit(Events::PIPELINE_AFTER_FLUSH, isPostFlush_);
 
 		onAfterFlush(isPostFlush_);
 	}
+
+	// An empty batch doesn't count, the reason mustn't stick to the next one
+	g_renderer.stats.flushReason = FLUSH_REASON::OTHER;
+}
+
+
+int Pipeline::streamVertices ()
+{
+	// Get size of a single vertex
+	int vertexSize_ = currentShader->vertexSize;
+	size_t size_ = vertexCount * vertexSize_;
+
+	switch (streaming) {
+		case BUFFER_STREAMING::ORPHAN:
+			// Detach the storage the GPU may still be reading from
+			glBufferData(GL_ARRAY_BUFFER, vertexData.size(), nullptr,
+					GL_STREAM_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, size_, vertexData.data());
+			return 0;
+
+		case BUFFER_STREAMING::ROUND_ROBIN:
+			vertexBuffer = vertexBuffers[streamIndex];
+			g_renderer.state.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+
+			// The vertex array captured the previous buffer, point it here
+			currentShader->setAttribPointers();
+
+			glBufferSubData(GL_ARRAY_BUFFER, 0, size_, vertexData.data());
+			return 0;
+
+		case BUFFER_STREAMING::MAP_UNSYNCHRONIZED: {
+			GLsync &fence_ = streamFences[streamIndex];
+
+			// Only wait if the GPU hasn't consumed this region yet
+			if (fence_) {
+				GLenum result_ = glClientWaitSync(fence_,
+						GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+				while (result_ == GL_TIMEOUT_EXPIRED)
+					result_ = glClientWaitSync(fence_, 0, 1000000);
+
+				glDeleteSync(fence_);
+				fence_ = nullptr;
+			}
+
+			GLintptr offset_ = streamIndex * vertexData.size();
+
+			void *data_ = glMapBufferRange(GL_ARRAY_BUFFER, offset_, size_,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
+					| GL_MAP_UNSYNCHRONIZED_BIT);
+
+			if (data_) {
+				memcpy(data_, vertexData.data(), size_);
+				glUnmapBuffer(GL_ARRAY_BUFFER);
+			}
+			else {
+				glBufferSubData(GL_ARRAY_BUFFER, offset_, size_,
+						vertexData.data());
+			}
+
+			return streamIndex * vertexCapacity;
+		}
+
+		default:
+			if (vertexCount == vertexCapacity)
+				glBufferData(GL_ARRAY_BUFFER, size_, vertexData.data(),
+						GL_DYNAMIC_DRAW);
+			else
+				glBufferSubData(GL_ARRAY_BUFFER, 0, size_, vertexData.data());
+			return 0;
+	}
 }
 
+void Pipeline::preRender ()
+{
+	frameFlushTime = 0.;
+	frameFlushCount = 0;
+
+	onPreRender();
+}
 
 void Pipeline::onActive ([[maybe_unused]] Shader* currentShader)
 {}
@@ -481,30 +677,13 @@ bool Pipeline::batchQuad (Entity gameObject, double x0, double y0, double x1,
 		double v0, double u1, double v1, int tintTL, int tintTR, int tintBL,
 		int tintBR, int tintEffect, GL_texture texture, int unit)
 {
-	if (unit < 0)
-		unit = currentUnit;
-
-	bool hasFlushed = false;
-
-	if (shouldFlush(6)) {
-		flush();
-		hasFlushed = true;
-		unit = setTexture2D(texture);
-	}
-
-	if (texture == 0)
-		tintEffect = 2;
-
-	batchVert(x0, y0, u0, v0, unit, tintEffect, tintTL);
-	batchVert(x1, y1, u0, v1, unit, tintEffect, tintBL);
-	batchVert(x2, y2, u1, v1, unit, tintEffect, tintBR);
-	batchVert(x0, y0, u0, v0, unit, tintEffect, tintTL);
-	batchVert(x2, y2, u1, v1, unit, tintEffect, tintBR);
-	batchVert(x3, y3, u1, v0, unit, tintEffect, tintTR);
-
-	onBatch(gameObject);
-
-	return hasFlushed;
+	// Vertices in the order 0, 1, 2, 3, so pipelines only have to specialize
+	// the array overload
+	return batchQuad(gameObject,
+			{x0, y0, x1, y1, x2, y2, x3, y3},
+			{u0, v0, u0, v1, u1, v1, u1, v0},
+			{tintTL, tintBL, tintBR, tintTR},
+			tintEffect, texture, unit);
 }
 
 bool Pipeline::batchQuad (Entity gameObject, std::array<double, 8> p,
@@ -516,7 +695,7 @@ bool Pipeline::batchQuad (Entity gameObject, std::array<double, 8> p,
 
 	bool hasFlushed = false;
 
-	if (shouldFlush(6)) {
+	if (shouldFlush(quadVertexCount)) {
 		flush();
 		hasFlushed = true;
 		unit = setTexture2D(texture);
@@ -528,8 +707,10 @@ bool Pipeline::batchQuad (Entity gameObject, std::array<double, 8> p,
 	batchVert(p[0], p[1], uv[0], uv[1], unit, tintEffect, tints[0]);
 	batchVert(p[2], p[3], uv[2], uv[3], unit, tintEffect, tints[1]);
 	batchVert(p[4], p[5], uv[4], uv[5], unit, tintEffect, tints[2]);
-	batchVert(p[0], p[1], uv[0], uv[1], unit, tintEffect, tints[0]);
-	batchVert(p[4], p[5], uv[4], uv[5], unit, tintEffect, tints[2]);
+	if (!indexedQuads) {
+		batchVert(p[0], p[1], uv[0], uv[1], unit, tintEffect, tints[0]);
+		batchVert(p[4], p[5], uv[4], uv[5], unit, tintEffect, tints[2]);
+	}
 	batchVert(p[6], p[7], uv[6], uv[7], unit, tintEffect, tints[3]);
 
 	onBatch(gameObject);
@@ -547,7 +728,7 @@ bool Pipeline::batchTri (Entity gameObject, double x0, double y0, double x1,
 
 	bool hasFlushed = false;
 
-	if (shouldFlush(3)) {
+	if (shouldFlush(indexedQuads ? 4 : 3)) {
 		flush();
 		hasFlushed = true;
 		unit = setTexture2D(texture);
@@ -557,6 +738,10 @@ bool Pipeline::batchTri (Entity gameObject, double x0, double y0, double x1,
 	batchVert(x1, y1, u0, v1, unit, tintEffect, tintTR);
 	batchVert(x2, y2, u1, v1, unit, tintEffect, tintBL);
 
+	// Indexed batches are made of quads only, so pad with a degenerate vertex
+	if (indexedQuads)
+		batchVert(x2, y2, u1, v1, unit, tintEffect, tintBL);
+
 	onBatch(gameObject);
 
 	return hasFlushed;
@@ -598,9 +783,7 @@ GLenum Pipeline::setTexture2D (GL_texture texture)
 
 void Pipeline::bindTexture (GL_texture texture, GLenum unit)
 {
-	glActiveTexture(unit);
-
-	glBindTexture(GL_TEXTURE_2D, texture);
+	g_renderer.state.bindTexture(unit, GL_TEXTURE_2D, texture);
 }
 
 void Pipeline::bindRenderTarget (RenderTarget* target, GLenum unit)
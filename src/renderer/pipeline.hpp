@@ -154,6 +154,9 @@ public:
      * You can optionally provide an `amount` parameter. If given, it will check if
 	 * the batch needs to flush _if_ the `amount` is added to it. This allows you
 	 * to test if you should flush before populating the batch.
+	 *
+	 * When it returns `true`, the next flush is counted as a full batch in the
+	 * render stats.
      *
      * @since 0.0.0
      *
@@ -187,12 +190,14 @@ public:
      *
      * @param width The new width of this pipeline.
      * @param height The new height of this pipeline.
+     * @param flipY Put the origin at the bottom instead, as when drawing to a
+	 * Render Texture.
      */
-    void setProjectionMatrix (int width, int height);
+    void setProjectionMatrix (int width, int height, bool flipY = false);
 
     /**
-     * Adjusts this pipelines orthonormal Projection Matrix to match that of the
-	 * global Renderer Projection Matrix.
+     * Adjusts this pipelines orthonormal Projection Matrix to match the game
+	 * size, or the Render Texture being drawn to.
      *
      * This method is called automatically by the Pipeline Manager when this
      * pipeline is set.
@@ -325,6 +330,26 @@ public:
      */
     void flush (bool isPostFlush = false);
 
+    /**
+     * Uploads the first `vertexCount` vertices of `vertexData` to the GPU,
+	 * following the streaming mode of this pipeline.
+     *
+     * The vertex array of this pipeline must be bound.
+     *
+     * @since 0.0.0
+     *
+     * @return The index of the first uploaded vertex in the bound vertex buffer.
+     */
+    int streamVertices ();
+
+    /**
+     * Resets the flush timings of this pipeline for the new frame, then calls
+	 * the `onPreRender` hook.
+     *
+     * @since 0.0.0
+     */
+    void preRender ();
+
     /**
      * By default this is an empty method hook that you can override and use in
 	 * your own custom pipelines.
@@ -538,6 +563,9 @@ public:
      *
      * Where tx0/ty0 = 0, tx1/ty1 = 1, tx2/ty2 = 2 and tx3/ty3 = 3
      *
+     * If this pipeline uses indexed quads, only the 4 corners are written and
+     * the shared index buffer builds the triangles A (0, 1, 2) and B (0, 2, 3).
+     *
      * @since 0.0.0
      *
      * @param gameObject The Game Object, if any, drawing this quad.
@@ -584,7 +612,7 @@ public:
      *
      * @return `true` if this method caused the batch to flush, otherwise `false`.
      */
-	bool batchQuad (Entity gameObject, std::array<double, 8> p,
+	virtual bool batchQuad (Entity gameObject, std::array<double, 8> p,
 			std::array<double, 8> uv, std::array<int, 4> tints, int tintEffect,
 			GL_texture texture, int unit);
 
@@ -603,6 +631,9 @@ public:
      * 1-----2
      * ```
      *
+     * If this pipeline uses indexed quads, the last vertex is repeated so the
+     * triangle can share the quad index buffer as a degenerate quad.
+     *
      * @since 0.0.0
      *
      * @param gameObject The Game Object, if any, drawing this quad.
@@ -626,9 +657,9 @@ public:
      *
      * @return `true` if this method caused the batch to flush, otherwise `false`.
      */
-    bool batchTri (Entity gameObject, double x0, double y0, double x1, double y1,
-			double x2, double y2, double u0, double v0, double u1, double v1,
-			int tintTL, int tintTR, int tintBL, int tintEffect,
+    virtual bool batchTri (Entity gameObject, double x0, double y0, double x1,
+			double y1, double x2, double y2, double u0, double v0, double u1,
+			double v1, int tintTL, int tintTR, int tintBL, int tintEffect,
 			GL_texture texture, GLenum unit = GL_NONE);
 
     /**
@@ -715,6 +746,21 @@ public:
 		currentShader->set(name, std::forward<Args>(args)...);
 	}
 
+	/**
+	 * Set a uniform value based on the given handle on the currently set
+	 * shader, skipping the name lookup.
+	 *
+	 * @since 0.0.0
+	 * @param handle The handle of the uniform to set.
+	 * @param args The value to set.
+	 */
+	template <typename ... Args>
+	void set (UniformHandle handle, Args&& ... args)
+	{
+		if (!currentShader) return;
+		currentShader->set(handle, std::forward<Args>(args)...);
+	}
+
 	/**
 	 * Set a uniform value based on the given name on the given shader.
 	 *
@@ -738,6 +784,24 @@ public:
 		shader->set(name, std::forward<Args>(args)...);
 	}
 
+	/**
+	 * Set a uniform value based on the given handle on the given shader,
+	 * skipping the name lookup.
+	 *
+	 * @since 0.0.0
+	 * @param shader The shader to set the values on.
+	 * @param handle The handle of the uniform to set.
+	 * @param args The value to set.
+	 */
+	template <typename ... Args>
+	void set (Shader* shader, UniformHandle handle, Args&& ... args)
+	{
+		if (!shader)
+			return;
+
+		shader->set(handle, std::forward<Args>(args)...);
+	}
+
 	void setCurrentShader (Shader *shader);
 	void setCurrentProgram (GLuint program);
 
@@ -777,6 +841,15 @@ public:
 	 */
 	int vertexCapacity = 0;
 
+	/**
+	 * The number of vertices a single quad takes in the batch.
+	 *
+	 * This is 6 by default, or 4 if this pipeline uses indexed quads.
+	 *
+	 * @since 0.0.0
+	 */
+	int quadVertexCount = 6;
+
 	/**
 	 * Raw byte buffer of vertices.
 	 *
@@ -801,6 +874,62 @@ public:
 	 */
 	GLuint vertexBuffer = 0;
 
+	/**
+	 * How the vertex buffer is streamed to the GPU on flush.
+	 *
+	 * Set from the `streaming` config property, or forced to `SUB_DATA` if the
+	 * pipeline uses static vertices.
+	 *
+	 * @since 0.0.0
+	 */
+	BUFFER_STREAMING streaming = BUFFER_STREAMING::SUB_DATA;
+
+	/**
+	 * The vertex buffers cycled through in `ROUND_ROBIN` streaming mode.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GL_vbo> vertexBuffers;
+
+	/**
+	 * The fences guarding each region of the vertex buffer in
+	 * `MAP_UNSYNCHRONIZED` streaming mode. A region is only written again once
+	 * its fence has been signaled.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLsync> streamFences;
+
+	/**
+	 * The vertex buffer, or buffer region, the next flush will upload to.
+	 *
+	 * @since 0.0.0
+	 */
+	int streamIndex = 0;
+
+	/**
+	 * The time, in milliseconds, the last flush of this pipeline took on the
+	 * CPU, upload and draw call included.
+	 *
+	 * @since 0.0.0
+	 */
+	double lastFlushTime = 0.;
+
+	/**
+	 * The total time, in milliseconds, spent flushing this pipeline during the
+	 * current frame.
+	 *
+	 * @since 0.0.0
+	 */
+	double frameFlushTime = 0.;
+
+	/**
+	 * The number of times this pipeline has flushed during the current frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameFlushCount = 0;
+
 	/**
 	 * The primitive topology which the pipeline will use to submit draw calls.
 	 *
@@ -808,6 +937,36 @@ public:
 	 */
 	GLenum topology = GL_TRIANGLES;
 
+	/**
+	 * Does this pipeline batch quads as 4 indexed vertices?
+	 *
+	 * Set from the `indexedQuads` config property. Only supported with the
+	 * `GL_TRIANGLES` topology.
+	 *
+	 * @since 0.0.0
+	 */
+	bool indexedQuads = false;
+
+	/**
+	 * The index buffer bound to the vertex array of this pipeline, if it uses
+	 * indexed quads.
+	 *
+	 * This is the Renderer's shared quad index buffer, it is not owned by this
+	 * pipeline.
+	 *
+	 * @since 0.0.0
+	 */
+	GL_ibo indexBuffer = 0;
+
+	/**
+	 * Can the shader of this pipeline sample the texture arrays of the
+	 * Renderer? Set when the arrays are enabled and its fragment shader has
+	 * the `%arrayselect%` placeholder.
+	 *
+	 * @since 0.0.0
+	 */
+	bool textureArrays = false;
+
 	/**
 	 * Indicates if the current pipeline is active, or not.
 	 *
@@ -911,6 +1070,20 @@ public:
 	 */
 	int projectionHeight = 0;
 
+	/**
+	 * The cached depth of the Projection matrix. See `Renderer::setDepth`.
+	 *
+	 * @since 0.0.0
+	 */
+	float projectionDepth = 0.f;
+
+	/**
+	 * Is the Projection matrix flipped for a Render Texture?
+	 *
+	 * @since 0.0.0
+	 */
+	bool projectionFlipY = false;
+
 	/**
 	 * The configuration object that was used to create this pipeline.
 	 *
@@ -11,6 +11,7 @@
 #include "pipelines/const.hpp"
 #include "pipelines/graphics_pipeline.hpp"
 #include "pipelines/single_pipeline.hpp"
+#include "pipelines/instanced_pipeline.hpp"
 #include "../systems/renderable.hpp"
 
 namespace Zen {
@@ -36,6 +37,7 @@ void PipelineManager::boot ()
 
 	add<MultiPipeline>(Pipelines::MULTI_PIPELINE);
 	add<SinglePipeline>(Pipelines::SINGLE_PIPELINE);
+	add<InstancedPipeline>(Pipelines::INSTANCED_PIPELINE);
 	add<BitmapMaskPipeline>(Pipelines::BITMAPMASK_PIPELINE);
 	add<GraphicsPipeline>(Pipelines::GRAPHICS_PIPELINE);
 	//add<LightPipeline>(Pipelines::LIGHT_PIPELINE);
@@ -57,10 +59,12 @@ void PipelineManager::boot ()
 	halfFrame2 = UTILITY_PIPELINE->halfFrame2;
 }
 
-void PipelineManager::flush ()
+void PipelineManager::flush (FLUSH_REASON reason_)
 {
-	if (current)
+	if (current) {
+		g_renderer.stats.flushReason = reason_;
 		current->flush();
+	}
 }
 
 bool PipelineManager::has (std::string name)
@@ -88,22 +92,32 @@ Pipeline* PipelineManager::set (std::string name, Entity entity,
 	if (!Contains(pipelines, name))
 		return nullptr;
 
-	Pipeline *pipeline = pipelines[name].get();
+	return set(pipelines[name].get(), entity, currentShader);
+}
+
+Pipeline* PipelineManager::set (Pipeline* pipeline, Entity entity,
+		Shader* currentShader)
+{
+	// Already bound, nothing else to do
+	if (isCurrent(pipeline, currentShader)) {
+		pipeline->onBind(entity);
+
+		return pipeline;
+	}
 
-	if (pipeline->isPostFX)
+	if (!pipeline || pipeline->isPostFX)
 		return nullptr;
 
-	if (!isCurrent(name, currentShader)) {
-		flush();
+	flush(FLUSH_REASON::PIPELINE);
 
-		if (current)
-			current->unbind();
+	if (current)
+		current->unbind();
 
-		current = pipeline;
+	current = pipeline;
 
-		pipeline->bind(currentShader);
-	}
+	pipeline->bind(currentShader);
 
+	// The projection is kept up to date by the resize event while bound
 	pipeline->updateProjectionMatrix();
 
 	pipeline->onBind(entity);
@@ -118,7 +132,7 @@ void PipelineManager::preBatch (Entity gameObject)
 	ZEN_ASSERT(renderable, "The entity has no 'Renderable' component");
 
 	if (!renderable->postPipelines.empty()) {
-		flush();
+		flush(FLUSH_REASON::PIPELINE);
 
 		auto &ps = renderable->postPipelines;
 
@@ -138,7 +152,7 @@ void PipelineManager::postBatch (Entity gameObject)
 	ZEN_ASSERT(renderable, "The entity has no 'Renderable' component");
 
 	if (!renderable->postPipelines.empty()) {
-		flush();
+		flush(FLUSH_REASON::PIPELINE);
 
 		auto &ps = renderable->postPipelines;
 
@@ -155,9 +169,18 @@ void PipelineManager::preBatchCamera (Entity camera)
 		g_registry.try_get<Components::Renderable>(camera);
 	ZEN_ASSERT(renderable, "The entity has no 'Renderable' component");
 
-	if (!renderable->postPipelines.empty()) {
+	// Keep the batch of the previous camera out of this one's timing
+	if (g_renderer.gpuTimer.enabled) {
 		flush();
 
+		timedCamera = camera;
+		cameraTiming = g_renderer.gpuTimer.begin(GPU_TIMING::CAMERA, "",
+				camera);
+	}
+
+	if (!renderable->postPipelines.empty()) {
+		flush(FLUSH_REASON::PIPELINE);
+
 		auto &ps = renderable->postPipelines;
 
 		// Iterate in reverse because we need them stacked in the order they're
@@ -176,7 +199,7 @@ void PipelineManager::postBatchCamera (Entity camera)
 	ZEN_ASSERT(renderable, "The entity has no 'Renderable' component");
 
 	if (!renderable->postPipelines.empty()) {
-		flush();
+		flush(FLUSH_REASON::PIPELINE);
 
 		auto &ps = renderable->postPipelines;
 
@@ -185,6 +208,14 @@ void PipelineManager::postBatchCamera (Entity camera)
 				p->postBatch(camera);
 		}
 	}
+
+	if (g_renderer.gpuTimer.enabled) {
+		flush();
+
+		g_renderer.gpuTimer.end(cameraTiming);
+		cameraTiming = -1;
+		timedCamera = entt::null;
+	}
 }
 
 bool PipelineManager::isCurrent (std::string name, Shader* currentShader)
@@ -195,13 +226,18 @@ bool PipelineManager::isCurrent (std::string name, Shader* currentShader)
 	if (!Contains(pipelines, name))
 		return false;
 
-	if (current && !currentShader)
-		currentShader = current->currentShader;
+	return isCurrent(pipelines[name].get(), currentShader);
+}
+
+bool PipelineManager::isCurrent (Pipeline* pipeline, Shader* currentShader)
+{
+	if (!current || current != pipeline)
+		return false;
 
-	Pipeline *pipeline = pipelines[name].get();
+	if (!currentShader)
+		currentShader = current->currentShader;
 
-	return !(current != pipeline ||
-			currentShader->program != g_renderer.currentProgram);
+	return (currentShader->program == g_renderer.currentProgram);
 }
 
 void PipelineManager::copyFrame (RenderTarget* source, RenderTarget* target,
@@ -264,7 +300,9 @@ bool PipelineManager::forceZero ()
 
 MultiPipeline& PipelineManager::setMulti ()
 {
-	return *static_cast<MultiPipeline*>(set(Pipelines::MULTI_PIPELINE));
+	set(MULTI_PIPELINE);
+
+	return *MULTI_PIPELINE;
 }
 
 UtilityPipeline& PipelineManager::setUtility (Shader* currentShader)
@@ -285,17 +323,17 @@ void PipelineManager::rebind (std::string name)
 			pipeline = pipelines[name].get();
 	}
 
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_CULL_FACE);
+	g_renderer.state.disable(GL_DEPTH_TEST);
+	g_renderer.state.disable(GL_CULL_FACE);
 
 	if (g_renderer.hasActiveStencilMask()) {
-		glClear(GL_DEPTH_BUFFER_BIT);
+		g_renderer.clear(GL_DEPTH_BUFFER_BIT);
 	}
 	else {
 		// If there wasn't a stencil mask set before this call, we can disable
 		// it safely
-		glDisable(GL_STENCIL_TEST);
-		glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+		g_renderer.state.disable(GL_STENCIL_TEST);
+		g_renderer.clear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 	}
 
 	g_renderer.resetViewport();
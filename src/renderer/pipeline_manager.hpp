@@ -12,6 +12,7 @@
 #include <string>
 #include <memory>
 #include "pipeline.hpp"
+#include "../enums/flush_reason.hpp"
 #include "render_target.hpp"
 #include "pipelines/utility_pipeline.hpp"
 #include "pipelines/multi_pipeline.hpp"
@@ -116,8 +117,10 @@ public:
      * Flushes the current pipeline, if one is bound.
      *
      * @since 0.0.0
+	 *
+	 * @param reason Why the batch is flushed, counted in the stats.
      */
-    void flush ();
+    void flush (FLUSH_REASON reason = FLUSH_REASON::OTHER);
 
     /**
      * Checks if a pipeline is present in this Pipeline Manager.
@@ -176,6 +179,25 @@ public:
     Pipeline* set (std::string pipeline, Entity entity = entt::null,
 			Shader* currentShader = nullptr);
 
+    /**
+     * Sets the current pipeline to be used by the Renderer, from a pointer to
+	 * it, as returned by `add` or `get`.
+     *
+     * This is the overload to use in hot paths, like batching a Game Object.
+	 * If the pipeline is already the current one, it is only a pointer
+	 * comparison before calling Pipeline::onBind.
+     *
+     * @since 0.0.0
+     *
+     * @param pipeline The pipeline to be set as current.
+     * @param gameObject The Game Object that invoked this pipeline, if any.
+     * @param currentShader The shader to set as being current.
+	 *
+     * @return The pipeline that was set, or nullptr if it couldn't be set.
+     */
+    Pipeline* set (Pipeline* pipeline, Entity entity = entt::null,
+			Shader* currentShader = nullptr);
+
     /**
      * This method is called by the Pipeline::batchQuad method, right before a quad
 	 * belonging to a Game Object is about to be added to the batch. It causes a
@@ -239,6 +261,18 @@ public:
      */
     bool isCurrent (std::string pipeline, Shader* currentShader = nullptr);
 
+    /**
+     * @overload
+     * @since 0.0.0
+     *
+     * @param pipeline The pipeline to be checked.
+     * @param The shader to set as being current.
+     *
+     * @return `true` if the given pipeline is already the current pipeline,
+	 * otherwise `false`.
+     */
+    bool isCurrent (Pipeline* pipeline, Shader* currentShader = nullptr);
+
     /**
      * Copy the `source` Render Target to the `target` Render Target.
      *
@@ -541,6 +575,21 @@ public:
 	 */
 	RenderTarget *halfFrame2 = nullptr;
 
+	/**
+	 * The camera being measured by the GPU timer, between
+	 * `preBatchCamera` and `postBatchCamera`.
+	 *
+	 * @since 0.0.0
+	 */
+	Entity timedCamera = entt::null;
+
+	/**
+	 * The GPU timer measure of the camera being rendered.
+	 *
+	 * @since 0.0.0
+	 */
+	int cameraTiming = -1;
+
 	UtilityPipeline *UTILITY_PIPELINE;
 
 	MultiPipeline *MULTI_PIPELINE;
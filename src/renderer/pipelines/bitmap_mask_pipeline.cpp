@@ -6,6 +6,7 @@
  */
 
 #include "bitmap_mask_pipeline.hpp"
+#include "../uniforms.hpp"
 
 #include "../renderer.hpp"
 #include "../../ecs/entity.hpp"
@@ -55,15 +56,15 @@ void BitmapMaskPipeline::boot ()
 {
 	Pipeline::boot();
 
-	set("uMainSampler", 0);
-	set("uMaskSampler", 1);
+	set(Uniforms::MAIN_SAMPLER, 0);
+	set(Uniforms::MASK_SAMPLER, 1);
 }
 
 void BitmapMaskPipeline::resize (double width, double height)
 {
 	Pipeline::resize(width, height);
 
-	set("uResolution", width, height);
+	set(Uniforms::RESOLUTION, width, height);
 }
 
 void BitmapMaskPipeline::beginMask (Entity mask, Entity camera)
@@ -71,13 +72,13 @@ void BitmapMaskPipeline::beginMask (Entity mask, Entity camera)
 	Components::Mask *m = g_registry.try_get<Components::Mask>(mask);
 
 	if (m && m->maskEntity != entt::null) {
-		g_renderer.flush();
+		g_renderer.flush(FLUSH_REASON::MASK);
 
 		g_renderer.pushFramebuffer(m->mainFramebuffer);
 
-		glDisable(GL_STENCIL_TEST);
-		glClearColor(0, 0, 0, 0);
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.state.disable(GL_STENCIL_TEST);
+		g_renderer.state.clearColor(0, 0, 0, 0);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 		if (g_renderer.currentCameraMask.mask != mask) {
 			g_renderer.currentMask.mask = mask;
@@ -93,21 +94,21 @@ void BitmapMaskPipeline::endMask (Entity maskEntity, Entity camera)
 	if (mask->maskEntity != entt::null) {
 		// mask.mainFramebuffer should now contain all the Game Objects we want
 		// masked
-		g_renderer.flush();
+		g_renderer.flush(FLUSH_REASON::MASK);
 
 		// Swap to the mask framebuffer (push, in case the bitmapMask GO has a
 		// post-pipeline)
 		g_renderer.pushFramebuffer(mask->maskFramebuffer);
 
 		// Clear it and draw the Game Object that is acting as a mask to it
-		glClearColor(0, 0, 0, 0);
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.state.clearColor(0, 0, 0, 0);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 		g_renderer.setBlendMode(0, true);
 
 		Render(mask->maskEntity, camera);
 
-		g_renderer.flush();
+		g_renderer.flush(FLUSH_REASON::MASK);
 
 		// Clear the mask framebuffer + main framebuffer
 		g_renderer.popFramebuffer();
@@ -116,7 +117,7 @@ void BitmapMaskPipeline::endMask (Entity maskEntity, Entity camera)
 		// Is there a stecil further up the stack?
 		auto prev = g_renderer.getCurrentStencilMask();
 		if (prev.mask != entt::null) {
-			glEnable(GL_STENCIL_TEST);
+			g_renderer.state.enable(GL_STENCIL_TEST);
 
 			ApplyStencil(prev.mask, prev.camera, true);
 		}
@@ -125,18 +126,19 @@ void BitmapMaskPipeline::endMask (Entity maskEntity, Entity camera)
 		}
 
 		// Bind this pipeline and draw
-		g_renderer.pipelines.set(name);
+		g_renderer.pipelines.set(this);
 
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, mask->maskTexture);
+		g_renderer.state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D,
+				mask->maskTexture);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, mask->mainTexture);
+		g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D,
+				mask->mainTexture);
 
-		set("uInvertMaskAlpha", mask->invertAlpha);
+		set(Uniforms::INVERT_MASK_ALPHA, mask->invertAlpha);
 
 		// Finally, draw a triangle filling the whole screen
-		glDrawArrays(topology, 0, 3);
+		g_renderer.drawArrays(name, topology, 0, 3);
+		g_renderer.stats.addDraw(name, 3);
 
 		g_renderer.resetTextures();
 	}
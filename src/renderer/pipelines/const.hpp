@@ -48,6 +48,13 @@ const std::string SINGLE_PIPELINE = "SinglePipeline";
  */
 const std::string MULTI_PIPELINE = "MultiPipeline";
 
+/**
+ * The Instanced Sprite Pipeline.
+ *
+ * @since 0.0.0
+ */
+const std::string INSTANCED_PIPELINE = "InstancedPipeline";
+
 /**
  * The Rope Pipeline.
  *
@@ -11,6 +11,9 @@
 #include "../shaders/graphics_vert.hpp"
 #include "../shaders/graphics_frag.hpp"
 #include "../utility.hpp"
+#include "../../utils/hash/fnv1a.hpp"
+#include <algorithm>
+#include <cmath>
 #include <earcut/earcut.hpp>
 
 namespace Zen {
@@ -62,7 +65,7 @@ void GraphicsPipeline::batchFillRect (double x, double y, double width,
 void GraphicsPipeline::batchFillRect (double x, double y, double width,
 		double height)
 {
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
 	// Use whatever values are already in the calcMatrix
 
@@ -99,7 +102,7 @@ void GraphicsPipeline::batchFillTriangle (double x0, double y0, double x1,
 void GraphicsPipeline::batchFillTriangle (double x0, double y0, double x1,
 		double y1, double x2, double y2)
 {
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
 	double tx0 = GetX(calcMatrix, x0, y0);
 	double ty0 = GetY(calcMatrix, x0, y0);
@@ -157,81 +160,233 @@ std::vector<std::vector<std::array<double, 2>>> setupPolylines (std::vector<doub
 
 void GraphicsPipeline::batchFillPath (std::vector<Math::Vector2> path)
 {
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
-	std::vector<std::uint32_t> polygonIndexArray;
+	batchTessellation(getFillTessellation(path), fillTint);
+}
+
+void GraphicsPipeline::batchStrokePath (std::vector<VerticeConfig> path,
+		double lineWidth, bool pathOpen, Components::TransformMatrix currentMatrix,
+		Components::TransformMatrix parentMatrix)
+{
+	g_renderer.pipelines.set(this);
+
+	calcMatrix = parentMatrix;
+	Multiply(&calcMatrix, currentMatrix);
+
+	batchTessellation(getStrokeTessellation(path, lineWidth, pathOpen),
+			strokeTint);
+}
+
+const Tessellation& GraphicsPipeline::getFillTessellation (
+		const std::vector<Math::Vector2>& path)
+{
+	tessellationSource.clear();
+	tessellationSource.push_back(0);
+
+	for (auto p : path) {
+		tessellationSource.push_back(p.x);
+		tessellationSource.push_back(p.y);
+	}
+
+	bool found;
+	Tessellation &tessellation = findTessellation(tessellationSource, &found);
+
+	if (found)
+		return tessellation;
 
 	for (auto p : path) {
 		polygonCache.push_back(p.x);
 		polygonCache.push_back(p.y);
 	}
 
-	polygonIndexArray = mapbox::earcut(setupPolylines(polygonCache));
+	std::vector<std::uint32_t> polygonIndexArray =
+		mapbox::earcut(setupPolylines(polygonCache));
+
+	// Each triangle takes the fill tints TL, TR and BL, as `batchTri` does
+	for (size_t i = 0; i + 2 < polygonIndexArray.size(); i += 3) {
+		for (size_t k = 0; k < 3; k++) {
+			size_t p = polygonIndexArray[i + k] * 2;
+
+			tessellation.vertices.push_back(polygonCache[p + 0]);
+			tessellation.vertices.push_back(polygonCache[p + 1]);
+			tessellation.tints.push_back(k);
+		}
+	}
+
+	polygonCache.clear();
+
+	return tessellation;
+}
+
+const Tessellation& GraphicsPipeline::getStrokeTessellation (
+		const std::vector<VerticeConfig>& path, double lineWidth, bool pathOpen)
+{
+	tessellationSource.clear();
+	tessellationSource.push_back(1);
+	tessellationSource.push_back(lineWidth);
+	tessellationSource.push_back(pathOpen);
+
+	for (auto &p : path) {
+		tessellationSource.push_back(p.x);
+		tessellationSource.push_back(p.y);
+		tessellationSource.push_back(p.lineWidth);
+	}
+
+	bool found;
+	Tessellation &tessellation = findTessellation(tessellationSource, &found);
+
+	if (found)
+		return tessellation;
+
+	// Same vertex and tint order as `batchQuad`
+	auto addQuad = [&tessellation] (double x0, double y0, double x1, double y1,
+			double x2, double y2, double x3, double y3) {
+		double p[8] = {x0, y0, x1, y1, x2, y2, x3, y3};
+
+		for (int c : {0, 1, 2, 0, 2, 3}) {
+			tessellation.vertices.push_back(p[c * 2]);
+			tessellation.vertices.push_back(p[c * 2 + 1]);
+		}
+
+		tessellation.tints.insert(tessellation.tints.end(), {0, 2, 3, 0, 3, 1});
+	};
+
+	// The quads and joins of `batchLine`, in local space. The transform is
+	// affine, so transforming them afterwards gives the same result
+	double first[5] = {0, 0, 0, 0, 0};
+	double prev[5] = {0, 0, 0, 0, 0};
+
+	for (size_t i = 0; i + 1 < path.size(); i++) {
+		double ax = path[i].x;
+		double ay = path[i].y;
+		double bx = path[i + 1].x;
+		double by = path[i + 1].y;
+		double aLineWidth = path[i].lineWidth / 2;
+		double bLineWidth = path[i + 1].lineWidth / 2;
+		bool closePath = !pathOpen && (i == path.size() - 2);
+
+		double dx = bx - ax;
+		double dy = by - ay;
+
+		double len = std::sqrt(dx * dx + dy * dy);
+		double al0 = aLineWidth * (by - ay) / len;
+		double al1 = aLineWidth * (ax - bx) / len;
+		double bl0 = bLineWidth * (by - ay) / len;
+		double bl1 = bLineWidth * (ax - bx) / len;
+
+		// Bottom right, bottom left, top right and top left
+		double brX = bx - bl0, brY = by - bl1;
+		double blX = ax - al0, blY = ay - al1;
+		double trX = bx + bl0, trY = by + bl1;
+		double tlX = ax + al0, tlY = ay + al1;
+
+		addQuad(tlX, tlY, blX, blY, brX, brY, trX, trY);
+
+		//  No point doing a linejoin if the line isn't thick enough
+		if (lineWidth <= 2)
+			continue;
+
+		if (i > 0 && prev[4]) {
+			addQuad(tlX, tlY, blX, blY, prev[0], prev[1], prev[2], prev[3]);
+		}
+		else {
+			first[0] = tlX;
+			first[1] = tlY;
+			first[2] = blX;
+			first[3] = blY;
+			first[4] = 1;
+		}
+
+		if (closePath && first[4]) {
+			//  Add a join for the final path segment
+			addQuad(brX, brY, trX, trY, first[0], first[1], first[2], first[3]);
+		}
+		else {
+			prev[0] = brX;
+			prev[1] = brY;
+			prev[2] = trX;
+			prev[3] = trY;
+			prev[4] = 1;
+		}
+	}
+
+	return tessellation;
+}
+
+Tessellation& GraphicsPipeline::findTessellation (
+		const std::vector<double>& source, bool *found)
+{
+	tessellationUses++;
+
+	std::uint64_t key = Fnv1a(source.data(), source.size() * sizeof(double));
+	auto it = tessellations.find(key);
 
-	for (size_t i = 0; i < polygonIndexArray.size(); i++) {
-		size_t p0 = polygonIndexArray[i + 0] * 2;
-		size_t p1 = polygonIndexArray[i + 1] * 2;
-		size_t p2 = polygonIndexArray[i + 2] * 2;
+	if (it != tessellations.end() && it->second.source == source) {
+		it->second.lastUse = tessellationUses;
+		*found = true;
 
-		double x0 = polygonCache[p0 + 0];
-		double y0 = polygonCache[p0 + 1];
-		double x1 = polygonCache[p1 + 0];
-		double y1 = polygonCache[p1 + 1];
-		double x2 = polygonCache[p2 + 0];
-		double y2 = polygonCache[p2 + 1];
+		return it->second;
+	}
 
-		double tx0 = GetX(calcMatrix, x0, y0);
-		double ty0 = GetY(calcMatrix, x0, y0);
+	// Discard the half used the longest ago
+	if (it == tessellations.end() && tessellations.size() >= MAX_TESSELLATIONS) {
+		std::vector<std::uint64_t> uses;
+		uses.reserve(tessellations.size());
 
-		double tx1 = GetX(calcMatrix, x1, y1);
-		double ty1 = GetY(calcMatrix, x1, y1);
+		for (auto &[key_, tessellation_] : tessellations)
+			uses.push_back(tessellation_.lastUse);
 
-		double tx2 = GetX(calcMatrix, x2, y2);
-		double ty2 = GetY(calcMatrix, x2, y2);
+		auto median = uses.begin() + uses.size() / 2;
+		std::nth_element(uses.begin(), median, uses.end());
 
-		batchTri(tx0, ty0, tx1, ty1, tx2, ty2, fillTint[0], fillTint[1],
-				fillTint[2]);
+		std::erase_if(tessellations, [median] (const auto& entry) {
+			return entry.second.lastUse < *median;
+		});
 	}
 
-	polygonCache.clear();
+	// A new source, or a collision which simply replaces the older one
+	Tessellation &tessellation = tessellations[key];
+	tessellation.source = source;
+	tessellation.vertices.clear();
+	tessellation.tints.clear();
+	tessellation.lastUse = tessellationUses;
+
+	*found = false;
+
+	return tessellation;
 }
 
-void GraphicsPipeline::batchStrokePath (std::vector<VerticeConfig> path,
-		double lineWidth, bool pathOpen, Components::TransformMatrix currentMatrix,
-		Components::TransformMatrix parentMatrix)
+void GraphicsPipeline::batchTessellation (const Tessellation& tessellation,
+		const int *tints)
 {
-	g_renderer.pipelines.set(name);
-
-	// Reset the closePath booleans
-	*prevQuad = {0};
-	*firstQuad = {0};
-
-	for (size_t i = 0; i < path.size()-1; i++) {
-		VerticeConfig point0 = path[i];
-		VerticeConfig point1 = path[i + 1];
-
-		batchLine(
-			point0.x,
-			point0.y,
-			point1.x,
-			point1.y,
-			point0.lineWidth / 2,
-			point1.lineWidth / 2,
-			lineWidth,
-			i,
-			!pathOpen && (i == path.size() - 1),
-			currentMatrix,
-			parentMatrix
-		);
+	auto &vertices = tessellation.vertices;
+
+	for (size_t i = 0; i < tessellation.tints.size(); i += 3) {
+		if (shouldFlush(3))
+			flush();
+
+		for (size_t k = i; k < i + 3; k++) {
+			double x = vertices[k * 2];
+			double y = vertices[k * 2 + 1];
+
+			batchVert(GetX(calcMatrix, x, y), GetY(calcMatrix, x, y),
+					tints[tessellation.tints[k]]);
+		}
 	}
 }
 
+void GraphicsPipeline::clearTessellations ()
+{
+	tessellations.clear();
+}
+
 void GraphicsPipeline::batchLine (double ax, double ay, double bx, double by,
 		double aLineWidth, double bLineWidth, double lineWidth, int index,
 		bool closePath, Components::TransformMatrix currentMatrix,
 		Components::TransformMatrix parentMatrix)
 {
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
 	calcMatrix = parentMatrix;
 	Multiply(&calcMatrix, currentMatrix);
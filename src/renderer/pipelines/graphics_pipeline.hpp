@@ -12,6 +12,9 @@
 #include "../../math/types/vector2.hpp"
 #include "../../components/transform_matrix.hpp"
 #include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace Zen {
 
@@ -21,6 +24,44 @@ struct VerticeConfig {
 	double lineWidth;
 };
 
+/**
+ * The triangles of a filled or stroked path, in the local space of the path.
+ *
+ * @struct Tessellation
+ * @since 0.0.0
+ */
+struct Tessellation {
+	/**
+	 * What was tessellated: the kind of path, its line width, if it is open
+	 * and its points. Compared on lookup, so a hash collision is harmless.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> source;
+
+	/**
+	 * The positions (x, y) of the vertices, three per triangle.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> vertices;
+
+	/**
+	 * The index of the tint (TL, TR, BL, BR) of each vertex, so the fill and
+	 * stroke colors can change without tessellating again.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::uint8_t> tints;
+
+	/**
+	 * When the tessellation was last used, to discard the oldest ones.
+	 *
+	 * @since 0.0.0
+	 */
+	std::uint64_t lastUse = 0;
+};
+
 class GraphicsPipeline : public Pipeline
 {
 public:
@@ -328,6 +369,96 @@ public:
 	 * @since 0.0.0
 	 */
 	std::vector<double> polygonCache;
+
+	/**
+	 * Discards all the cached tessellations.
+	 *
+	 * @since 0.0.0
+	 */
+	void clearTessellations ();
+
+	/**
+	 * The maximum number of tessellations kept. Past it, the half used the
+	 * longest ago is discarded.
+	 *
+	 * @since 0.0.0
+	 */
+	static const std::size_t MAX_TESSELLATIONS = 1024;
+
+private:
+	/**
+	 * Gets the triangles of a filled path, triangulating it with earcut if
+	 * they aren't cached yet.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path The points of the path.
+	 *
+	 * @return The tessellation.
+	 */
+	const Tessellation& getFillTessellation (
+			const std::vector<Math::Vector2>& path);
+
+	/**
+	 * Gets the triangles of a stroked path, line joins included, generating
+	 * them if they aren't cached yet.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path The points of the path.
+	 * @param lineWidth The width of the line.
+	 * @param pathOpen Is the path open, so its ends aren't joined?
+	 *
+	 * @return The tessellation.
+	 */
+	const Tessellation& getStrokeTessellation (
+			const std::vector<VerticeConfig>& path, double lineWidth,
+			bool pathOpen);
+
+	/**
+	 * Finds the cached tessellation of a source, or creates an empty one.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param source What is tessellated, see `Tessellation::source`.
+	 * @param found A pointer to store if the tessellation was cached in.
+	 *
+	 * @return The tessellation.
+	 */
+	Tessellation& findTessellation (const std::vector<double>& source,
+			bool *found);
+
+	/**
+	 * Transforms a tessellation with the `calcMatrix` and adds its triangles
+	 * to the vertex batch.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param tessellation The tessellation to draw.
+	 * @param tints The tints (TL, TR, BL, BR) to use.
+	 */
+	void batchTessellation (const Tessellation& tessellation, const int *tints);
+
+	/**
+	 * The cached tessellations, by hash of their source.
+	 *
+	 * @since 0.0.0
+	 */
+	std::unordered_map<std::uint64_t, Tessellation> tessellations;
+
+	/**
+	 * Used internally to build the source of a tessellation to look up.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<double> tessellationSource;
+
+	/**
+	 * Counts the lookups, to date the use of the tessellations.
+	 *
+	 * @since 0.0.0
+	 */
+	std::uint64_t tessellationUses = 0;
 };
 
 }	// namespace Zen
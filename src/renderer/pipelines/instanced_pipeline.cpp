@@ -0,0 +1,220 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "instanced_pipeline.hpp"
+#include "../../ecs/entity.hpp"
+#include "../../scale/scale_manager.hpp"
+#include "../renderer.hpp"
+#include "../../systems/position.hpp"
+#include "../../systems/tint.hpp"
+
+#include "../shaders/instanced_vert.hpp"
+
+namespace Zen {
+
+extern Renderer g_renderer;
+extern ScaleManager g_scale;
+
+InstancedPipeline::InstancedPipeline (PipelineConfig config)
+	: MultiPipeline(prepareConfig(config))
+{}
+
+PipelineConfig InstancedPipeline::prepareConfig (PipelineConfig config)
+{
+	config.vertShader = Shaders::INSTANCED_VERT;
+	config.instanced = true;
+
+	config.attributes = {
+		{
+			.name = "aTransform",
+			.size = 4,
+			.divisor = 1
+		},
+		{
+			.name = "aTranslate",
+			.size = 2,
+			.divisor = 1
+		},
+		{
+			.name = "aFrame",
+			.size = 4,
+			.divisor = 1
+		},
+		{
+			.name = "aParams",
+			.size = 4,
+			.divisor = 1
+		},
+		{
+			.name = "aTint0",
+			.size = 4,
+			.type = GL_UNSIGNED_BYTE,
+			.normalized = true,
+			.divisor = 1
+		},
+		{
+			.name = "aTint1",
+			.size = 4,
+			.type = GL_UNSIGNED_BYTE,
+			.normalized = true,
+			.divisor = 1
+		},
+		{
+			.name = "aTint2",
+			.size = 4,
+			.type = GL_UNSIGNED_BYTE,
+			.normalized = true,
+			.divisor = 1
+		},
+		{
+			.name = "aTint3",
+			.size = 4,
+			.type = GL_UNSIGNED_BYTE,
+			.normalized = true,
+			.divisor = 1
+		}
+	};
+
+	return config;
+}
+
+void InstancedPipeline::batchSprite (Entity gameObject, Entity camera,
+		Components::TransformMatrix *parentTransformMatrix)
+{
+	g_renderer.pipelines.set(this, gameObject);
+
+	SpriteQuad quad;
+	if (!prepareSprite(gameObject, camera, parentTransformMatrix, &quad))
+		return;
+
+	auto &m = quad.matrix;
+
+	// Fold the local quad into the matrix, so the shader only has to map the
+	// unit square
+	double a = m.a * quad.width;
+	double b = m.b * quad.width;
+	double c = m.c * quad.height;
+	double d = m.d * quad.height;
+	double e = m.a * quad.x + m.c * quad.y + m.e;
+	double f = m.b * quad.x + m.d * quad.y + m.f;
+
+	double l = e + std::min(0., a) + std::min(0., c),
+		   r = e + std::max(0., a) + std::max(0., c),
+		   t = f + std::min(0., b) + std::min(0., d),
+		   bottom = f + std::max(0., b) + std::max(0., d),
+		   w = g_scale.gameSize.width,
+		   h = g_scale.gameSize.height;
+
+	if (l > w || r < 0 || t > h || bottom < 0) {
+		// Skip rendering this object if it is completely out of the screen
+		return;
+	}
+
+	int tintTL, tintTR, tintBL, tintBR;
+	getSpriteTints(gameObject, camera, &tintTL, &tintTR, &tintBL, &tintBR);
+
+	bool tintFill = IsTintFilled(gameObject);
+
+	if (shouldFlush(quadVertexCount))
+		flush();
+
+	int unit = setGameObject(gameObject);
+
+	g_renderer.pipelines.preBatch(gameObject);
+
+	// Same corner tints as the vertices written by the Multi Pipeline
+	batchInstance(gameObject,
+			{a, b, c, d, e, f},
+			{quad.u0, quad.v0, quad.u1, quad.v1},
+			quad.rotated,
+			{tintTL, tintTR, tintBL, tintBR},
+			tintFill, quad.texture, unit, GetRoundPixels(camera));
+
+	g_renderer.pipelines.postBatch(gameObject);
+}
+
+bool InstancedPipeline::batchQuad (Entity gameObject, std::array<double, 8> p,
+		std::array<double, 8> uv, std::array<int, 4> tints, int tintEffect,
+		GL_texture texture, int unit)
+{
+	// Corner 0 is the origin, corner 3 the X axis and corner 1 the Y axis
+	std::array<double, 6> matrix_ = {
+		p[6] - p[0], p[7] - p[1],
+		p[2] - p[0], p[3] - p[1],
+		p[0], p[1]
+	};
+
+	// Rotated frames go along the U axis from corner 0 to corner 1
+	bool rotated_ = (uv[2] != uv[0]);
+
+	return batchInstance(gameObject, matrix_, {uv[0], uv[1], uv[4], uv[5]},
+			rotated_, tints, tintEffect, texture, unit);
+}
+
+bool InstancedPipeline::batchTri (Entity gameObject, double x0, double y0,
+		double x1, double y1, double x2, double y2, double u0, double v0,
+		double u1, double v1, int tintTL, int tintTR, int tintBL,
+		int tintEffect, GL_texture texture, [[maybe_unused]] GLenum unit)
+{
+	// The inherited method would write three Multi vertices into the
+	// instance stream
+	MultiPipeline *multi = g_renderer.pipelines.MULTI_PIPELINE;
+
+	g_renderer.pipelines.set(multi, gameObject);
+
+	return multi->batchTri(gameObject, x0, y0, x1, y1, x2, y2, u0, v0, u1, v1,
+			tintTL, tintTR, tintBL, tintEffect, texture,
+			multi->setTexture2D(texture));
+}
+
+bool InstancedPipeline::batchInstance (Entity gameObject,
+		std::array<double, 6> matrix, std::array<double, 4> frame, bool rotated,
+		std::array<int, 4> tints, int tintEffect, GL_texture texture, int unit,
+		bool roundPixels)
+{
+	if (unit < 0)
+		unit = currentUnit;
+
+	bool hasFlushed = false;
+
+	if (shouldFlush(1)) {
+		flush();
+		hasFlushed = true;
+		unit = setTexture2D(texture);
+	}
+
+	if (texture == 0)
+		tintEffect = 2;
+
+	float *viewF32 = reinterpret_cast<float*>(vertexData.data());
+	std::uint32_t *viewU32 = reinterpret_cast<std::uint32_t*>(
+			vertexData.data());
+
+	int offset = (vertexCount * currentShader->vertexComponentCount) - 1;
+
+	for (double component : matrix)
+		viewF32[++offset] = static_cast<float>(component);
+
+	for (double uv : frame)
+		viewF32[++offset] = static_cast<float>(uv);
+
+	viewF32[++offset] = unit;
+	viewF32[++offset] = tintEffect;
+	viewF32[++offset] = rotated;
+	viewF32[++offset] = roundPixels;
+
+	for (int tint : tints)
+		viewU32[++offset] = tint;
+
+	vertexCount++;
+
+	onBatch(gameObject);
+
+	return hasFlushed;
+}
+
+}	// namespace Zen
@@ -0,0 +1,156 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_PIPELINES_INSTANCED_HPP
+#define ZEN_RENDERER_PIPELINES_INSTANCED_HPP
+
+#include "multi_pipeline.hpp"
+
+namespace Zen {
+
+/**
+ * The Instanced Pipeline is a drop-in replacement of the Multi Pipeline for
+ * large amounts of Sprites.
+ *
+ * Instead of transforming the 4 corners of every quad on the CPU, it uploads a
+ * single compact record per quad and lets the vertex shader expand it with
+ * `glDrawArraysInstanced`. Select it for a Game Object by setting its
+ * Renderable pipeline to `Pipelines::INSTANCED_PIPELINE`.
+ *
+ * The vertex shader it uses can be found in `shaders/src/instanced.vert`.
+ * The fragment shader is the one of the Multi Pipeline.
+ *
+ * The per-instance attributes for this pipeline are:
+ * - `aTransform` (vec4, offset 0), the `a`, `b`, `c` and `d` components of the
+ * matrix mapping the unit square to the screen
+ * - `aTranslate` (vec2, offset 16), the `e` and `f` components of that matrix
+ * - `aFrame` (vec4, offset 24), the `u0`, `v0`, `u1` and `v1` frame UVs
+ * - `aParams` (vec4, offset 40), the texture unit, tint effect, rotated frame
+ * and round pixels flags
+ * - `aTint0` to `aTint3` (vec4, offset 56 to 68, normalized), the corner tints
+ *
+ * @since 0.0.0
+ */
+class InstancedPipeline : public MultiPipeline
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param config The configuration options for this pipeline.
+	 */
+	InstancedPipeline (PipelineConfig config);
+
+	/**
+	 * @since 0.0.0
+	 */
+	PipelineConfig prepareConfig (PipelineConfig config);
+
+    /**
+     * Takes a Sprite Game Object, or any object that extends it, and adds a
+	 * single instance record for it to the batch.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The texture based Game Object to add to the batch.
+     * @param camera The Camera to use for the rendering transform.
+     * @param parentTransformMatrix The transform matrix of the parent container,
+	 * if set.
+     */
+    void batchSprite (Entity gameObject, Entity camera,
+			Components::TransformMatrix *parentTransformMatrix = nullptr);
+
+	using Pipeline::batchQuad;
+
+    /**
+     * Adds an already transformed quad to the batch as an instance record.
+     *
+     * The quad must be a parallelogram, which is the case of any rectangle
+	 * transformed by an affine matrix.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The Game Object, if any, drawing this quad.
+     * @param p The vertices positions, in the order 0, 1, 2, 3.
+     * @param uv The vertices UV coordinates, in the order 0, 1, 2, 3.
+     * @param tints The vertices tints, in the order 0, 1, 2, 3.
+     * @param tintEffect The tint effect for the shader to use.
+     * @param texture Texture that will be assigned to the current batch if a
+	 * flush occurs.
+     * @param unit Texture unit to which the texture needs to be bound.
+     *
+     * @return `true` if this method caused the batch to flush, otherwise `false`.
+     */
+	bool batchQuad (Entity gameObject, std::array<double, 8> p,
+			std::array<double, 8> uv, std::array<int, 4> tints, int tintEffect,
+			GL_texture texture, int unit);
+
+    /**
+     * A triangle can't be drawn as an instance of the unit square, so it is
+	 * batched by the Multi Pipeline instead, which flushes the instances
+	 * batched so far.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The Game Object, if any, drawing this triangle.
+     * @param x0 The top-left x position.
+     * @param y0 The top-left y position.
+     * @param x1 The bottom-left x position.
+     * @param y1 The bottom-left y position.
+     * @param x2 The bottom-right x position.
+     * @param y2 The bottom-right y position.
+     * @param u0 UV u0 value.
+     * @param v0 UV v0 value.
+     * @param u1 UV u1 value.
+     * @param v1 UV v1 value.
+     * @param tintTL The top-left tint color value.
+     * @param tintTR The top-right tint color value.
+     * @param tintBL The bottom-left tint color value.
+     * @param tintEffect The tint effect for the shader to use.
+     * @param texture Texture that will be assigned to the current batch if a
+	 * flush occurs.
+     * @param unit Ignored, the texture is bound for the Multi Pipeline.
+     *
+     * @return `true` if this method caused the batch to flush, otherwise `false`.
+     */
+    bool batchTri (Entity gameObject, double x0, double y0, double x1,
+			double y1, double x2, double y2, double u0, double v0, double u1,
+			double v1, int tintTL, int tintTR, int tintBL, int tintEffect,
+			GL_texture texture, GLenum unit = GL_NONE) override;
+
+    /**
+     * Adds a single instance record into the batch and flushes if full.
+     *
+     * The unit square, with corners 0 (top-left), 1 (bottom-left),
+	 * 2 (bottom-right) and 3 (top-right), is mapped to the screen by the given
+	 * matrix.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The Game Object, if any, drawing this quad.
+     * @param matrix The `a`, `b`, `c`, `d`, `e` and `f` components of the
+	 * matrix.
+     * @param frame The `u0`, `v0`, `u1` and `v1` UVs of the frame.
+     * @param rotated Is the frame rotated in its texture?
+     * @param tints The corners tints, in the order 0, 1, 2, 3.
+     * @param tintEffect The tint effect for the shader to use.
+     * @param texture Texture that will be assigned to the current batch if a
+	 * flush occurs.
+     * @param unit Texture unit to which the texture needs to be bound.
+     * @param roundPixels Should the corners be rounded to the nearest pixel?
+     *
+     * @return `true` if this method caused the batch to flush, otherwise `false`.
+     */
+	bool batchInstance (Entity gameObject, std::array<double, 6> matrix,
+			std::array<double, 4> frame, bool rotated, std::array<int, 4> tints,
+			int tintEffect, GL_texture texture, int unit,
+			bool roundPixels = false);
+};
+
+}	// namespace Zen
+
+#endif
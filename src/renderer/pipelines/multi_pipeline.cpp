@@ -6,18 +6,33 @@
  */
 
 #include "multi_pipeline.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include "../uniforms.hpp"
 #include "../../ecs/entity.hpp"
 #include "../../scale/scale_manager.hpp"
 #include "../../text/text_manager.hpp"
 #include "../renderer.hpp"
 #include "../utility.hpp"
 #include "../../utils/file/file_to_string.hpp"
+#include "../../utils/memory/frame_arena.hpp"
 #include "../../texture/components/frame.hpp"
 #include "../../texture/components/source.hpp"
 #include "../../components/text.hpp"
 #include "../../components/position.hpp"
 #include "../../components/origin.hpp"
 #include "../../components/size.hpp"
+#include "../../components/dirty.hpp"
+#include "../../components/alpha.hpp"
+#include "../../components/textured.hpp"
+#include "../../components/crop.hpp"
+#include "../../components/rotation.hpp"
+#include "../../components/scale.hpp"
+#include "../../components/flip.hpp"
+#include "../../components/scroll.hpp"
+#include "../../components/scroll_factor.hpp"
+#include "../../components/tint.hpp"
 #include "../../texture/systems/frame.hpp"
 #include "../../systems/origin.hpp"
 #include "../../systems/textured.hpp"
@@ -44,6 +59,7 @@ extern entt::registry g_registry;
 extern Renderer g_renderer;
 extern ScaleManager g_scale;
 extern TextManager g_text;
+extern FrameArena g_frameArena;
 
 MultiPipeline::MultiPipeline (PipelineConfig config)
 	: Pipeline(prepareConfig(config))
@@ -55,12 +71,13 @@ PipelineConfig MultiPipeline::prepareConfig (PipelineConfig config)
 	if (config.fragShader.empty())
 		config.fragShader = Shaders::MULTI_FRAG;
 
-	config.fragShader = ParseFragmentShaderMaxTextures(config.fragShader,
-			g_renderer.maxTextures);
-
 	if (config.vertShader.empty())
 		config.vertShader = Shaders::MULTI_VERT;
 
+	// Quads are batched as 4 vertices drawn through the shared index buffer,
+	// unless they are expanded from instance records
+	config.indexedQuads = !config.instanced;
+
 	if (config.attributes.empty()) {
 		config.attributes = {
 			{
@@ -92,22 +109,397 @@ PipelineConfig MultiPipeline::prepareConfig (PipelineConfig config)
 void MultiPipeline::boot ()
 {
 	Pipeline::boot();
-	currentShader->set("uMainSampler", g_renderer.textureIndexes);
+	currentShader->set(Uniforms::MAIN_SAMPLER, g_renderer.textureIndexes);
+
+	if (textureArrays)
+		currentShader->set(Uniforms::ARRAY_SAMPLER,
+				g_renderer.textureArrays.unitIndexes);
 }
 
 void MultiPipeline::batchSprite (Entity gameObject, Entity camera,
 		Components::TransformMatrix *parentTransformMatrix)
 {
-	g_renderer.pipelines.set(name, gameObject);
+	g_renderer.pipelines.set(this, gameObject);
+
+	computeSprites({&gameObject, 1}, camera, parentTransformMatrix,
+			&singleSprite);
+	g_renderer.stats.computedSprites++;
+
+	if (singleSprite.gameObjects.empty() || !singleSprite.corners.visible[0])
+		return;
+
+	SpriteVertices sprite;
+	getSpriteVertices(singleSprite, 0, camera, &sprite);
+
+	if (shouldFlush(quadVertexCount))
+		flush();
+
+	int unit = setGameObject(gameObject);
+
+	g_renderer.pipelines.preBatch(gameObject);
+
+	batchQuad(gameObject, sprite.p, sprite.uv, sprite.tints, sprite.tintEffect,
+			sprite.texture, unit);
+
+	g_renderer.pipelines.postBatch(gameObject);
+}
+
+void MultiPipeline::batchSprites (std::span<const Entity> gameObjects,
+		Entity camera)
+{
+	if (gameObjects.empty())
+		return;
+
+	g_renderer.pipelines.set(this, gameObjects[0]);
+
+	const int stride_ = currentShader->vertexSize;
+	const int components_ = currentShader->vertexComponentCount;
+
+	// The registry creates the pool of a component on its first lookup, which
+	// mustn't happen on the workers. Create the pools of all the components
+	// read by `computeSprites` here, whatever the first chunk looks up
+	[[maybe_unused]] auto pools_ = g_registry.view<Components::Alpha,
+		Components::Textured, Components::Crop, Components::Frame,
+		Components::TextureSource, Components::Origin, Components::Size,
+		Components::Position, Components::Rotation, Components::Scale,
+		Components::Flip, Components::ScrollFactor, Components::Scroll,
+		Components::TransformMatrix, Components::Tint>();
+
+	// Generate the vertices of each chunk in its own staging buffer
+	int chunkCount_ = (gameObjects.size() + spriteChunkSize - 1)
+		/ spriteChunkSize;
+
+	if (static_cast<int>(spriteChunks.size()) < chunkCount_)
+		spriteChunks.resize(chunkCount_);
+
+	const size_t quadSize_ = stride_ * quadVertexCount;
+	const auto view_ = getCacheView(camera);
+
+	// The vertex caches are looked up here, as the workers don't access the
+	// registry pools of the caches
+	spriteCaches.resize(gameObjects.size());
+
+	for (size_t i = 0; i < gameObjects.size(); i++) {
+		spriteCaches[i] = getSpriteCache(gameObjects[i], view_);
+
+		if (spriteCaches[i].entry)
+			g_renderer.stats.cachedSprites++;
+	}
+
+	auto generate_ = [&] (int chunkIndex_) {
+		auto &chunk_ = spriteChunks[chunkIndex_];
+		chunk_.gameObjects.clear();
+		chunk_.sources.clear();
+		chunk_.vertices.clear();
+		chunk_.pending.clear();
+		chunk_.updates.clear();
+
+		size_t first_ = chunkIndex_ * spriteChunkSize;
+		size_t last_ = std::min(first_ + spriteChunkSize, gameObjects.size());
+
+		// Only the sprites without up to date cached vertices are computed
+		for (size_t i = first_; i < last_; i++) {
+			if (!spriteCaches[i].entry)
+				chunk_.pending.emplace_back(gameObjects[i]);
+		}
+
+		auto &run_ = chunk_.sprites;
+		computeSprites(chunk_.pending, camera, nullptr, &run_);
+
+		SpriteVertices sprite_;
+		size_t next_ = 0;
+
+		for (size_t i = first_; i < last_; i++) {
+			Entity gameObject_ = gameObjects[i];
+			const auto *entry_ = spriteCaches[i].entry;
+
+			if (entry_) {
+				if (!entry_->visible)
+					continue;
+
+				chunk_.vertices.insert(chunk_.vertices.end(),
+						entry_->vertices.begin(), entry_->vertices.end());
+
+				chunk_.gameObjects.emplace_back(gameObject_);
+				chunk_.sources.emplace_back(entry_->source);
+
+				continue;
+			}
+
+			// Skipped by `computeSprites` as fully transparent
+			bool computed_ = next_ < run_.gameObjects.size()
+				&& run_.gameObjects[next_] == gameObject_;
+			bool visible_ = computed_ && run_.corners.visible[next_];
+
+			size_t offset_ = chunk_.vertices.size();
+
+			if (visible_) {
+				getSpriteVertices(run_, next_, camera, &sprite_);
+
+				chunk_.vertices.resize(offset_ + quadSize_);
+				writeSprite(sprite_, chunk_.vertices.data() + offset_);
+
+				chunk_.gameObjects.emplace_back(gameObject_);
+				chunk_.sources.emplace_back(sprite_.source);
+			}
+
+			if (computed_)
+				next_++;
+
+			// Stored once all the chunks are done
+			if (spriteCaches[i].cache)
+				chunk_.updates.push_back({
+					.index = i,
+					.visible = visible_,
+					.source = visible_ ? sprite_.source : entt::null,
+					.offset = offset_
+				});
+		}
+	};
+
+	generate_(0);
+
+	g_renderer.workers.run(chunkCount_ - 1, [&] (int index_) {
+		generate_(index_ + 1);
+	});
+
+	// Store the generated vertices of the sprites retaining them
+	for (int c = 0; c < chunkCount_; c++) {
+		auto &chunk_ = spriteChunks[c];
+
+		g_renderer.stats.computedSprites += chunk_.pending.size();
+
+		for (auto &update_ : chunk_.updates) {
+			std::span<const std::uint8_t> vertices_;
+			if (update_.visible)
+				vertices_ = {chunk_.vertices.data() + update_.offset, quadSize_};
+
+			storeSpriteCache(spriteCaches[update_.index], view_,
+					update_.visible, update_.source, vertices_);
+		}
+	}
+
+	// Assign the texture units and copy the chunks into the batch, in order
+	for (int c = 0; c < chunkCount_; c++) {
+		auto &chunk_ = spriteChunks[c];
+		const std::uint8_t *src_ = chunk_.vertices.data();
+
+		for (size_t i = 0; i < chunk_.gameObjects.size(); i++) {
+			Entity gameObject_ = chunk_.gameObjects[i];
+
+			g_renderer.pipelines.set(this, gameObject_);
+
+			if (shouldFlush(quadVertexCount))
+				flush();
+
+			currentUnit = g_renderer.setTextureSource(chunk_.sources[i]);
+
+			std::uint8_t *dst_ = vertexData.data() + vertexCount * stride_;
+			std::memcpy(dst_, src_, stride_ * quadVertexCount);
+			src_ += stride_ * quadVertexCount;
+
+			float *view_ = reinterpret_cast<float*>(dst_);
+			for (int v = 0; v < quadVertexCount; v++)
+				view_[v * components_ + 4] = currentUnit;
+
+			vertexCount += quadVertexCount;
+
+			onBatch(gameObject_);
+		}
+	}
+}
+
+Components::VertexCache::View MultiPipeline::getCacheView (Entity camera)
+{
+	auto matrix = GetTransformMatrix(camera);
+
+	Components::VertexCache::View view;
+	view.camera = camera;
+	view.a = matrix.a;
+	view.b = matrix.b;
+	view.c = matrix.c;
+	view.d = matrix.d;
+	view.e = matrix.e;
+	view.f = matrix.f;
+	view.scrollX = GetScrollX(camera);
+	view.scrollY = GetScrollY(camera);
+	view.alpha = GetAlpha(camera);
+	view.roundPixels = GetRoundPixels(camera);
+	view.width = g_scale.gameSize.width;
+	view.height = g_scale.gameSize.height;
+
+	return view;
+}
+
+MultiPipeline::SpriteCache MultiPipeline::getSpriteCache (Entity gameObject,
+		const Components::VertexCache::View& view)
+{
+	SpriteCache sprite;
 
+	auto [cache, dirty] = g_registry.try_get<Components::VertexCache,
+		 Components::Dirty>(gameObject);
+
+	if (!cache || !dirty)
+		return sprite;
+
+	sprite.cache = cache;
+	sprite.dirty = dirty;
+
+	if (dirty->value)
+		return sprite;
+
+	for (auto &entry : cache->entries) {
+		if (!(entry.view == view))
+			continue;
+
+		// The vertices may have been written by a pipeline of another format
+		if (!entry.visible || static_cast<int>(entry.vertices.size())
+				== currentShader->vertexSize * quadVertexCount)
+			sprite.entry = &entry;
+
+		break;
+	}
+
+	return sprite;
+}
+
+void MultiPipeline::storeSpriteCache (const SpriteCache& sprite,
+		const Components::VertexCache::View& view, bool visible,
+		Entity source, std::span<const std::uint8_t> vertices)
+{
+	auto &entries = sprite.cache->entries;
+
+	// The vertices of the other cameras predate the change
+	if (sprite.dirty->value) {
+		std::erase_if(entries, [&] (const auto &entry) {
+			return entry.view.camera != view.camera;
+		});
+
+		sprite.dirty->value = false;
+	}
+
+	auto it = std::find_if(entries.begin(), entries.end(),
+			[&] (const auto &entry) {
+				return entry.view.camera == view.camera;
+			});
+
+	if (it == entries.end())
+		it = entries.emplace(entries.end());
+
+	it->view = view;
+	it->visible = visible;
+	it->source = source;
+	it->vertices.assign(vertices.begin(), vertices.end());
+}
+
+void MultiPipeline::computeSprites (std::span<const Entity> gameObjects,
+		Entity camera, Components::TransformMatrix *parentTransformMatrix,
+		SpriteRun *run)
+{
+	run->quads.clear();
+	run->gameObjects.clear();
+
+	SpriteQuad quad;
+
+	for (auto gameObject : gameObjects) {
+		if (!prepareSprite(gameObject, camera, parentTransformMatrix, &quad))
+			continue;
+
+		run->quads.emplace_back(quad);
+		run->gameObjects.emplace_back(gameObject);
+	}
+
+	auto &transforms = run->transforms;
+	transforms.resize(run->quads.size());
+
+	for (size_t i = 0; i < run->quads.size(); i++) {
+		auto &q = run->quads[i];
+
+		transforms.a[i] = q.matrix.a;
+		transforms.b[i] = q.matrix.b;
+		transforms.c[i] = q.matrix.c;
+		transforms.d[i] = q.matrix.d;
+		transforms.tx[i] = q.matrix.e;
+		transforms.ty[i] = q.matrix.f;
+		transforms.x[i] = q.x;
+		transforms.y[i] = q.y;
+		transforms.width[i] = q.width;
+		transforms.height[i] = q.height;
+	}
+
+	// Transform all the corners and skip the Game Objects out of the screen
+	TransformSpriteCorners(transforms, GetRoundPixels(camera),
+			g_scale.gameSize.width, g_scale.gameSize.height, &run->corners);
+}
+
+void MultiPipeline::getSpriteVertices (const SpriteRun& run, size_t index,
+		Entity camera, SpriteVertices *sprite)
+{
+	auto &quad = run.quads[index];
+	auto &corners = run.corners;
+	Entity gameObject = run.gameObjects[index];
+
+	double u0 = quad.u0, v0 = quad.v0, u1 = quad.u1, v1 = quad.v1;
+
+	int tintTL, tintTR, tintBL, tintBR;
+	getSpriteTints(gameObject, camera, &tintTL, &tintTR, &tintBL, &tintBR);
+
+	if (quad.rotated)
+		 sprite->uv = {u0, v0, u1, v0, u1, v1, u0, v1};
+	else
+		 sprite->uv = {u0, v0, u0, v1, u1, v1, u1, v0};
+
+	for (int i = 0; i < 4; i++) {
+		sprite->p[i * 2] = corners.x[i][index];
+		sprite->p[i * 2 + 1] = corners.y[i][index];
+	}
+
+	sprite->tints = {tintTL, tintTR, tintBL, tintBR};
+	sprite->tintEffect = IsTintFilled(gameObject);
+	sprite->texture = quad.texture;
+	sprite->source = quad.source;
+}
+
+void MultiPipeline::writeSprite (const SpriteVertices& sprite,
+		std::uint8_t *data)
+{
+	float *viewF32 = reinterpret_cast<float*>(data);
+	std::uint32_t *viewU32 = reinterpret_cast<std::uint32_t*>(data);
+
+	int offset = -1;
+	int tintEffect = (sprite.texture == 0) ? 2 : sprite.tintEffect;
+
+	// Same vertex order as `batchQuad`, the texture unit is set when copied
+	// into the batch
+	std::array<int, 6> corners = {0, 1, 2, 0, 2, 3};
+	if (indexedQuads)
+		corners = {0, 1, 2, 3, 0, 0};
+
+	for (int i = 0; i < quadVertexCount; i++) {
+		int c = corners[i];
+
+		viewF32[++offset] = static_cast<float>(sprite.p[c * 2]);
+		viewF32[++offset] = static_cast<float>(sprite.p[c * 2 + 1]);
+		viewF32[++offset] = static_cast<float>(sprite.uv[c * 2]);
+		viewF32[++offset] = static_cast<float>(sprite.uv[c * 2 + 1]);
+		viewF32[++offset] = 0;
+		viewF32[++offset] = tintEffect;
+		viewU32[++offset] = sprite.tints[c];
+	}
+}
+
+bool MultiPipeline::prepareSprite (Entity gameObject, Entity camera,
+		Components::TransformMatrix *parentTransformMatrix, SpriteQuad *quad)
+{
 	double alpha = GetAlpha(camera) * GetAlpha(gameObject);
 	if (!alpha)
 		// Nothing to see, so abort early
-		return;
+		return false;
 
-	auto &camMatrix = tempMatrix1;
-	auto &spriteMatrix = tempMatrix2;
-	auto &calcMatrix = tempMatrix3;
+	// Local matrices, as sprites may be prepared on several threads at once
+	Components::TransformMatrix camMatrix;
+	Components::TransformMatrix spriteMatrix;
+	auto &calcMatrix = quad->matrix;
 
 	auto *frame = g_registry.try_get<Components::Frame>(GetFrame(gameObject));
 	auto *source = g_registry.try_get<Components::TextureSource>(frame->source);
@@ -202,68 +594,33 @@ void MultiPipeline::batchSprite (Entity gameObject, Entity camera,
 	calcMatrix = camMatrix;
 	Multiply(&calcMatrix, spriteMatrix);
 
-	double xw = x + frameWidth;
-	double yh = y + frameHeight;
-
-	bool roundPixels = GetRoundPixels(camera);
-
-	double tx0 = GetXRound(calcMatrix, x, y, roundPixels);
-	double ty0 = GetYRound(calcMatrix, x, y, roundPixels);
-
-	double tx1 = GetXRound(calcMatrix, x, yh, roundPixels);
-	double ty1 = GetYRound(calcMatrix, x, yh, roundPixels);
-
-	double tx2 = GetXRound(calcMatrix, xw, yh, roundPixels);
-	double ty2 = GetYRound(calcMatrix, xw, yh, roundPixels);
-
-	double tx3 = GetXRound(calcMatrix, xw, y, roundPixels);
-	double ty3 = GetYRound(calcMatrix, xw, y, roundPixels);
-
-	double l = std::min({tx0, tx1, tx2, tx3}),
-		   r = std::max({tx0, tx1, tx2, tx3}),
-		   t = std::min({ty0, ty1, ty2, ty3}),
-		   b = std::max({ty0, ty1, ty2, ty3}),
-		   w = g_scale.gameSize.width,
-		   h = g_scale.gameSize.height;
-
-	if (l > w || r < 0 || t > h || b < 0) {
-		// Skip rendering this object if it is completely out of the screen
-		return;
-	}
+	quad->x = x;
+	quad->y = y;
+	quad->width = frameWidth;
+	quad->height = frameHeight;
+	quad->u0 = u0;
+	quad->v0 = v0;
+	quad->u1 = u1;
+	quad->v1 = v1;
+	quad->rotated = frame->rotated;
+	quad->texture = texture;
+	quad->source = frame->source;
+
+	return true;
+}
 
+void MultiPipeline::getSpriteTints (Entity gameObject, Entity camera,
+		int *tintTL, int *tintTR, int *tintBL, int *tintBR)
+{
 	double cameraAlpha = GetAlpha(camera);
-	int tintTL, tintTR, tintBL, tintBR;
-	GetTint(gameObject, &tintTL, &tintTR, &tintBL, &tintBR);
+	GetTint(gameObject, tintTL, tintTR, tintBL, tintBR);
 	double atl, atr, abl, abr;
 	GetAlpha(gameObject, &atl, &atr, &abl, &abr);
 
-	tintTL = GetTintAppendFloatAlpha(tintTL, cameraAlpha * atl);
-	tintTR = GetTintAppendFloatAlpha(tintTR, cameraAlpha * atr);
-	tintBL = GetTintAppendFloatAlpha(tintBL, cameraAlpha * abl);
-	tintBR = GetTintAppendFloatAlpha(tintBR, cameraAlpha * abr);
-
-	bool tintFill = IsTintFilled(gameObject);
-
-	if (shouldFlush(6))
-		flush();
-
-	int unit = setGameObject(gameObject);
-
-	g_renderer.pipelines.preBatch(gameObject);
-
-	std::array<double, 8> uvs;
-	if (frame->rotated)
-		 uvs = {u0, v0, u1, v0, u1, v1, u0, v1};
-	else
-		 uvs = {u0, v0, u0, v1, u1, v1, u1, v0};
-
-	batchQuad(gameObject,
-			{tx0, ty0, tx1, ty1, tx2, ty2, tx3, ty3},
-			uvs,
-			{tintTL, tintTR, tintBL, tintBR},
-			tintFill, texture, unit);
-
-	g_renderer.pipelines.postBatch(gameObject);
+	*tintTL = GetTintAppendFloatAlpha(*tintTL, cameraAlpha * atl);
+	*tintTR = GetTintAppendFloatAlpha(*tintTR, cameraAlpha * atr);
+	*tintBL = GetTintAppendFloatAlpha(*tintBL, cameraAlpha * abl);
+	*tintBR = GetTintAppendFloatAlpha(*tintBR, cameraAlpha * abr);
 }
 
 void MultiPipeline::batchTexture (
@@ -286,7 +643,7 @@ void MultiPipeline::batchTexture (
 	int textureUnit
 	)
 {
-	g_renderer.pipelines.set(name, gameObject);
+	g_renderer.pipelines.set(this, gameObject);
 
 	auto &camMatrix = tempMatrix1;
 	auto &spriteMatrix = tempMatrix2;
@@ -412,11 +769,11 @@ void MultiPipeline::batchTextureFrame (
 	Components::TransformMatrix *parentTransformMatrix
 	)
 {
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
 	auto *fr = g_registry.try_get<Components::Frame>(frame);
 
-	g_renderer.pipelines.set(name);
+	g_renderer.pipelines.set(this);
 
 	auto &spriteMatrix = tempMatrix1;
 	auto &calcMatrix = tempMatrix2;
@@ -459,7 +816,7 @@ void MultiPipeline::batchTextureFrame (
 void MultiPipeline::batchText (Entity textEntity, Entity camera,
 		Components::TransformMatrix *parentTransformMatrix)
 {
-	g_renderer.pipelines.set(name, textEntity);
+	g_renderer.pipelines.set(this, textEntity);
 
 	auto [text, position, origin, size] = g_registry.try_get<Components::Text,
 		 Components::Position, Components::Origin, Components::Size>(textEntity);
@@ -485,18 +842,18 @@ void MultiPipeline::batchText (Entity textEntity, Entity camera,
 	SetHex(&textColor, text->style.color);
 
 	// Convert all characters to unicodes
-	std::vector<int> characters = g_text.stringToUnicodes(text->content);
+	auto characters = g_text.stringToUnicodes(text->content, g_frameArena);
 
-	// Get the bounding box of each lines of this text object
-	std::vector<Rectangle> bboxes =
-		g_text.getLinesBoundingBox(characters, text->style);
+	// Get the width of each lines of this text object
+	auto linesWidth = g_text.getLinesWidth(characters, text->style,
+			g_frameArena);
 	size_t line = 0;
 
 	// Get the widest line
 	int largestLineWidth = 0;
-	for (Rectangle bbox : bboxes) {
-		if (bbox.width > largestLineWidth)
-			largestLineWidth = bbox.width;
+	for (double width : linesWidth) {
+		if (width > largestLineWidth)
+			largestLineWidth = width;
 	}
 
 	// Initial pen position
@@ -539,11 +896,11 @@ void MultiPipeline::batchText (Entity textEntity, Entity camera,
 			penX = posX;
 			break;
 		case TEXT_ALIGNMENT::RIGHT:
-			penX = posX + largestLineWidth - bboxes[0].width;
+			penX = posX + largestLineWidth - linesWidth[0];
 			break;
 		case TEXT_ALIGNMENT::CENTER:
 			penX = posX + (largestLineWidth/2.) -
-				(bboxes[0].width/2);
+				(linesWidth[0]/2);
 			break;
 	}
 
@@ -567,11 +924,11 @@ void MultiPipeline::batchText (Entity textEntity, Entity camera,
 						penX = posX;
 						break;
 					case TEXT_ALIGNMENT::RIGHT:
-						penX = posX + largestLineWidth - bboxes[line].width;
+						penX = posX + largestLineWidth - linesWidth[line];
 						break;
 					case TEXT_ALIGNMENT::CENTER:
 						penX = posX + (largestLineWidth/2.) -
-							(bboxes[line].width/2);
+							(linesWidth[line]/2);
 						break;
 				}
 
@@ -656,7 +1013,7 @@ void MultiPipeline::batchText (Entity textEntity, Entity camera,
 		tintBL = GetTintAppendFloatAlpha(tintTL, cameraAlpha * abl);
 		tintBR = GetTintAppendFloatAlpha(tintTL, cameraAlpha * abr);
 
-		if (shouldFlush(6))
+		if (shouldFlush(quadVertexCount))
 			flush();
 
 		int unit = g_renderer.setTexture2D(atlas.texture);
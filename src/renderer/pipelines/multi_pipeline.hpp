@@ -8,8 +8,15 @@
 #ifndef ZEN_RENDERER_PIPELINES_MULTI_HPP
 #define ZEN_RENDERER_PIPELINES_MULTI_HPP
 
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
 #include "../pipeline.hpp"
+#include "../sprite_corners.hpp"
 #include "../../components/transform_matrix.hpp"
+#include "../../components/vertex_cache.hpp"
+#include "../../components/dirty.hpp"
 
 namespace Zen {
 
@@ -83,9 +90,40 @@ public:
      * @param parentTransformMatrix The transform matrix of the parent container,
 	 * if set.
      */
-    void batchSprite (Entity gameObject, Entity camera,
+    virtual void batchSprite (Entity gameObject, Entity camera,
 			Components::TransformMatrix *parentTransformMatrix = nullptr);
 
+    /**
+     * Adds a run of Sprite Game Objects to the batch, the same way as calling
+	 * `batchSprite` for each of them, but transforming their corners at once
+	 * and generating their vertices on the worker threads of the Renderer, if
+	 * any.
+     *
+	 * The Game Objects are split in chunks of `spriteChunkSize`, whose vertices
+	 * are written to staging buffers, in parallel when the Renderer has worker
+	 * threads. The texture units, which
+	 * need OpenGL calls, are then assigned on the calling thread while the
+	 * staging buffers are copied into the batch in order. The vertex caches
+	 * are also read and written on the calling thread only.
+	 *
+	 * The Game Objects must not have a parent container, a mask or Post FX
+	 * pipelines.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObjects The Sprite Game Objects to add to the batch, in
+	 * rendering order.
+     * @param camera The Camera to use for the rendering transform.
+     */
+    void batchSprites (std::span<const Entity> gameObjects, Entity camera);
+
+	/**
+	 * The number of Game Objects per job of `batchSprites`.
+	 *
+	 * @since 0.0.0
+	 */
+	int spriteChunkSize = 256;
+
     /**
      * Generic function for batching a textured quad using argument values instead
 	 * of a Game Object.
@@ -171,7 +209,242 @@ public:
     void batchText (Entity gameObject, Entity camera,
 			Components::TransformMatrix *parentTransformMatrix = nullptr);
 
-private:
+protected:
+	/**
+	 * The untransformed quad of a Sprite, along with the matrix to bring it to
+	 * screen space, as computed by `prepareSprite`.
+	 *
+	 * @since 0.0.0
+	 */
+	struct SpriteQuad {
+		Components::TransformMatrix matrix;
+		double x = 0.;
+		double y = 0.;
+		double width = 0.;
+		double height = 0.;
+		double u0 = 0.;
+		double v0 = 0.;
+		double u1 = 1.;
+		double v1 = 1.;
+		bool rotated = false;
+		GL_texture texture = 0;
+		Entity source = entt::null;
+	};
+
+	/**
+	 * The screen space corners of a Sprite, in the order top-left,
+	 * bottom-left, bottom-right and top-right, ready to be batched.
+	 *
+	 * @since 0.0.0
+	 */
+	struct SpriteVertices {
+		std::array<double, 8> p;
+		std::array<double, 8> uv;
+		std::array<int, 4> tints;
+		int tintEffect = 0;
+		GL_texture texture = 0;
+		Entity source = entt::null;
+	};
+
+	/**
+	 * The prepared Sprites of a run, with their transforms laid out for
+	 * `TransformSpriteCorners`.
+	 *
+	 * @since 0.0.0
+	 */
+	struct SpriteRun {
+		std::vector<SpriteQuad> quads;
+		std::vector<Entity> gameObjects;
+		SpriteTransforms transforms;
+		SpriteCorners corners;
+	};
+
+	/**
+	 * The vertex cache components of a sprite of `batchSprites`, looked up on
+	 * the calling thread before the chunks are generated.
+	 *
+	 * @since 0.0.0
+	 */
+	struct SpriteCache {
+		Components::VertexCache *cache = nullptr;
+		Components::Dirty *dirty = nullptr;
+
+		/**
+		 * The up to date vertices for the camera, if any.
+		 *
+		 * @since 0.0.0
+		 */
+		const Components::VertexCache::Entry *entry = nullptr;
+	};
+
+	/**
+	 * The vertices generated by a worker for a sprite retaining them, stored
+	 * in its vertex cache on the calling thread once all the chunks are done.
+	 *
+	 * @since 0.0.0
+	 */
+	struct CacheUpdate {
+		std::size_t index = 0;
+		bool visible = false;
+		Entity source = entt::null;
+		std::size_t offset = 0;
+	};
+
+	/**
+	 * The staging buffer of a chunk of `batchSprites`.
+	 *
+	 * @since 0.0.0
+	 */
+	struct SpriteChunk {
+		SpriteRun sprites;
+		std::vector<std::uint8_t> vertices;
+		std::vector<Entity> gameObjects;
+		std::vector<Entity> sources;
+		std::vector<Entity> pending;
+		std::vector<CacheUpdate> updates;
+	};
+
+	/**
+	 * Gets the state of a camera the sprite vertex caches are checked
+	 * against.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param camera The Camera rendering the sprites.
+	 *
+	 * @return The camera state.
+	 */
+	Components::VertexCache::View getCacheView (Entity camera);
+
+	/**
+	 * Looks up the vertex cache of a sprite, and the vertices it retains for
+	 * the camera if they are still up to date.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param gameObject The sprite.
+	 * @param view The state of the camera rendering the sprite.
+	 *
+	 * @return The vertex cache components of the sprite.
+	 */
+	SpriteCache getSpriteCache (Entity gameObject,
+			const Components::VertexCache::View& view);
+
+	/**
+	 * Stores the vertices generated for a camera in the vertex cache of a
+	 * sprite, and clears its dirty flag.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param sprite The vertex cache components of the sprite.
+	 * @param view The state of the camera rendering the sprite.
+	 * @param visible Was the sprite in the camera view?
+	 * @param source The Texture Source of the sprite frame.
+	 * @param vertices The vertices of the quad, empty if not visible.
+	 */
+	void storeSpriteCache (const SpriteCache& sprite,
+			const Components::VertexCache::View& view, bool visible,
+			Entity source, std::span<const std::uint8_t> vertices);
+
+    /**
+     * Computes the local quad, frame UVs and transform matrix of a Sprite
+	 * Game Object for the given camera, taking its crop, flip and origin into
+	 * account.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The texture based Game Object.
+     * @param camera The Camera to use for the rendering transform.
+     * @param parentTransformMatrix The transform matrix of the parent container,
+	 * if set.
+     * @param quad The quad to fill.
+	 *
+     * @return `false` if the Game Object is fully transparent and should be
+	 * skipped.
+     */
+	bool prepareSprite (Entity gameObject, Entity camera,
+			Components::TransformMatrix *parentTransformMatrix, SpriteQuad *quad);
+
+    /**
+     * Gets the 4 corner tints of a Game Object, with the alpha of the Game
+	 * Object and the camera appended.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObject The Game Object.
+     * @param camera The Camera rendering the Game Object.
+     * @param tintTL A pointer to store the top-left tint in.
+     * @param tintTR A pointer to store the top-right tint in.
+     * @param tintBL A pointer to store the bottom-left tint in.
+     * @param tintBR A pointer to store the bottom-right tint in.
+     */
+	void getSpriteTints (Entity gameObject, Entity camera, int *tintTL,
+			int *tintTR, int *tintBL, int *tintBR);
+
+    /**
+     * Prepares a run of Sprite Game Objects and computes their screen space
+	 * corners all at once, with `TransformSpriteCorners`.
+	 *
+	 * Only reads the Game Objects, so it can run on worker threads.
+     *
+     * @since 0.0.0
+     *
+     * @param gameObjects The texture based Game Objects.
+     * @param camera The Camera to use for the rendering transform.
+     * @param parentTransformMatrix The transform matrix of the parent container,
+	 * if set.
+     * @param run The run to fill. Transparent Game Objects are left out of it.
+     */
+	void computeSprites (std::span<const Entity> gameObjects, Entity camera,
+			Components::TransformMatrix *parentTransformMatrix,
+			SpriteRun *run);
+
+    /**
+     * Gets the vertices of a visible Sprite of a computed run.
+     *
+     * @since 0.0.0
+     *
+     * @param run The computed run.
+     * @param index The index of the Sprite in the run.
+     * @param camera The Camera to use for the rendering transform.
+     * @param sprite The vertices to fill.
+     */
+	void getSpriteVertices (const SpriteRun& run, size_t index, Entity camera,
+			SpriteVertices *sprite);
+
+    /**
+     * Writes the vertices of a Sprite with the layout of this pipeline, leaving
+	 * their texture unit to 0.
+     *
+     * @since 0.0.0
+     *
+     * @param sprite The Sprite vertices.
+     * @param data Where to write `quadVertexCount` vertices.
+     */
+	void writeSprite (const SpriteVertices& sprite, std::uint8_t *data);
+
+	/**
+	 * The staging buffers of `batchSprites`, kept to reuse their storage.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SpriteChunk> spriteChunks;
+
+	/**
+	 * The vertex cache components of the sprites of `batchSprites`, kept to
+	 * reuse their storage.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<SpriteCache> spriteCaches;
+
+	/**
+	 * The run of `batchSprite`, kept to reuse its storage.
+	 *
+	 * @since 0.0.0
+	 */
+	SpriteRun singleSprite;
+
 	/**
 	 * A temporary Transform Matrix, re-used internally during batching.
 	 *
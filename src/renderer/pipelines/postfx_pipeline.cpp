@@ -6,6 +6,7 @@
  */
 
 #include "postfx_pipeline.hpp"
+#include "../uniforms.hpp"
 
 #include "../shaders/quad_vert.hpp"
 #include "../shaders/post_fx_frag.hpp"
@@ -74,7 +75,7 @@ void PostFXPipeline::boot ()
 	halfFrame1 = g_renderer.pipelines.UTILITY_PIPELINE->halfFrame1;
 	halfFrame2 = g_renderer.pipelines.UTILITY_PIPELINE->halfFrame2;
 
-	set("uMainSampler", 0);
+	set(Uniforms::MAIN_SAMPLER, 0);
 }
 
 void PostFXPipeline::onDraw (RenderTarget *renderTarget)
@@ -136,21 +137,21 @@ void PostFXPipeline::bindAndDraw (RenderTarget *source_, RenderTarget *target_,
 {
 	bind(currentShader_);
 
-	set("uMainSampler", 0);
+	set(Uniforms::MAIN_SAMPLER, 0);
 
 	if (target_) {
-		glViewport(0, 0, target_->width, target_->height);
-		glBindFramebuffer(GL_FRAMEBUFFER, target_->framebuffer);
+		g_renderer.state.viewport(0, 0, target_->width, target_->height);
+		g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target_->framebuffer);
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
 				GL_TEXTURE_2D, target_->texture, 0);
 
 		if (clear_) {
 			if (clearAlpha_)
-				glClearColor(0.f, 0.f, 0.f, 0.f);
+				g_renderer.state.clearColor(0.f, 0.f, 0.f, 0.f);
 			else
-				glClearColor(0.f, 0.f, 0.f, 1.f);
+				g_renderer.state.clearColor(0.f, 0.f, 0.f, 1.f);
 
-			glClear(GL_COLOR_BUFFER_BIT);
+			g_renderer.clear(GL_COLOR_BUFFER_BIT);
 		}
 	}
 	else {
@@ -158,25 +159,25 @@ void PostFXPipeline::bindAndDraw (RenderTarget *source_, RenderTarget *target_,
 		g_renderer.popFramebuffer(false, false, false);
 
 		if (!g_renderer.currentFramebuffer) {
-			glViewport(0, 0, g_window.width(), g_window.height());
-			glDisable(GL_SCISSOR_TEST);
+			g_renderer.state.viewport(0, 0, g_window.width(), g_window.height());
+			g_renderer.state.disable(GL_SCISSOR_TEST);
 		}
 	}
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source_->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source_->texture);
 
 	setVertexArray();
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 	unsetVertexArray();
 
 	if (!target_) {
-		glEnable(GL_SCISSOR_TEST);
+		g_renderer.state.enable(GL_SCISSOR_TEST);
 		g_renderer.resetTextures();
 	}
 	else {
-		glBindTexture(GL_TEXTURE_2D, 0);
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
+		g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
 
 	g_renderer.resetViewport();
@@ -6,6 +6,7 @@
  */
 
 #include "single_pipeline.hpp"
+#include "../uniforms.hpp"
 #include "../shaders/single_frag.hpp"
 #include "../shaders/single_vert.hpp"
 
@@ -28,7 +29,7 @@ void SinglePipeline::boot ()
 {
 	Pipeline::boot();
 
-	set("uMainSampler", 0);
+	set(Uniforms::MAIN_SAMPLER, 0);
 }
 
 }	// namespace Zen
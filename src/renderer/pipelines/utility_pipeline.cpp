@@ -6,6 +6,7 @@
  */
 
 #include "utility_pipeline.hpp"
+#include "../uniforms.hpp"
 #include "../renderer.hpp"
 #include "../../display/color_matrix.hpp"
 #include "../../utils/file/file_to_string.hpp"
@@ -92,69 +93,68 @@ void UtilityPipeline::copyFrame (RenderTarget* source, RenderTarget* target,
 		double brightness, bool clear, bool clearAlpha)
 {
 	setShader(copyShader);
-	set("uMainSampler", 0);
-	set("uBrightness", brightness);
+	set(Uniforms::MAIN_SAMPLER, 0);
+	set(Uniforms::BRIGHTNESS, brightness);
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source->texture);
 
 	if (target->texture) {
-		glViewport(0, 0, target->width, target->height);
-		glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+		g_renderer.state.viewport(0, 0, target->width, target->height);
+		g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
 				target->texture, 0);
 	}
 	else {
-		glViewport(0, 0, source->width, source->height);
+		g_renderer.state.viewport(0, 0, source->width, source->height);
 	}
 
 	if (clear) {
 		if (clearAlpha)
-			glClearColor(0, 0, 0, 0);
+			g_renderer.state.clearColor(0, 0, 0, 0);
 		else
-			glClearColor(0, 0, 0, 1);
+			g_renderer.state.clearColor(0, 0, 0, 1);
 
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 	}
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * vertexData.size(),
 			vertexData.data(), GL_STATIC_DRAW);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+	g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
 }
 
 void UtilityPipeline::blitFrame (RenderTarget* source, RenderTarget* target,
 		double brightness, bool clear, bool clearAlpha, bool eraseMode)
 {
 	setShader(copyShader);
-	set("uMainSampler", 0);
-	set("uBrightness", brightness);
+	set(Uniforms::MAIN_SAMPLER, 0);
+	set(Uniforms::BRIGHTNESS, brightness);
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source->texture);
 
 	if (source->height > target->height) {
-		glViewport(0, 0, source->width, source->height);
+		g_renderer.state.viewport(0, 0, source->width, source->height);
 		setTargetUVs(source, target);
 	}
 	else {
 		double diff = target->height - source->height;
-		glViewport(0, diff, source->width, source->height);
+		g_renderer.state.viewport(0, diff, source->width, source->height);
 	}
 
-	glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
 			target->texture, 0);
 
 	if (clear) {
 		if (clearAlpha)
-			glClearColor(0, 0, 0, 0);
+			g_renderer.state.clearColor(0, 0, 0, 0);
 		else
-			glClearColor(0, 0, 0, 1);
+			g_renderer.state.clearColor(0, 0, 0, 1);
 
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 	}
 
 	int blendMode;
@@ -165,14 +165,15 @@ void UtilityPipeline::blitFrame (RenderTarget* source, RenderTarget* target,
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * vertexData.size(),
 			vertexData.data(), GL_STATIC_DRAW);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 
 	if (eraseMode) {
 		g_renderer.setBlendMode(blendMode);
 	}
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+	g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
 
 	resetUVs();
 }
@@ -180,42 +181,41 @@ void UtilityPipeline::blitFrame (RenderTarget* source, RenderTarget* target,
 void UtilityPipeline::copyFrameRect (RenderTarget* source, RenderTarget*
 		target, int x, int y, int width, int height, bool clear, bool clearAlpha)
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, source->framebuffer);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, source->framebuffer);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
 			source->texture, 0);
 
 	if (clear) {
 		if (clearAlpha)
-			glClearColor(0, 0, 0, 0);
+			g_renderer.state.clearColor(0, 0, 0, 0);
 		else
-			glClearColor(0, 0, 0, 1);
+			g_renderer.state.clearColor(0, 0, 0, 1);
 
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 	}
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, target->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, target->texture);
 
 	glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, x, y, width, height);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+	g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
 }
 
 void UtilityPipeline::copyToGame (RenderTarget* source)
 {
 	setShader(copyShader);
-	set("uMainSampler", 0);
-	set("uBrightness", 1);
+	set(Uniforms::MAIN_SAMPLER, 0);
+	set(Uniforms::BRIGHTNESS, 1);
 
 	g_renderer.popFramebuffer();
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source->texture);
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * vertexData.size(),
 			vertexData.data(), GL_STATIC_DRAW);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 
 	g_renderer.resetTextures();
 }
@@ -225,38 +225,38 @@ void UtilityPipeline::drawFrame (RenderTarget* source, RenderTarget* target,
 {
 	setShader(colorMatrixShader);
 
-	set("uMainSampler", 0);
-	set("uColorMatrix", GetData(colorMatrix));
-	set("uAlpha", colorMatrix->alpha);
+	set(Uniforms::MAIN_SAMPLER, 0);
+	set(Uniforms::COLOR_MATRIX, GetData(colorMatrix));
+	set(Uniforms::ALPHA, colorMatrix->alpha);
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source->texture);
 
 	if (target->texture) {
-		glViewport(0, 0, target->width, target->height);
-		glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+		g_renderer.state.viewport(0, 0, target->width, target->height);
+		g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
 				GL_TEXTURE_2D, target->texture, 0);
 	}
 	else {
-		glViewport(0, 0, source->width, source->height);
+		g_renderer.state.viewport(0, 0, source->width, source->height);
 	}
 
 	if (clearAlpha) {
-		glClearColor(0, 0, 0, 0);
+		g_renderer.state.clearColor(0, 0, 0, 0);
 	}
 	else {
-		glClearColor(0, 0, 0, 1);
+		g_renderer.state.clearColor(0, 0, 0, 1);
 	}
 
-	glClear(GL_COLOR_BUFFER_BIT);
+	g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * vertexData.size(),
 			vertexData.data(), GL_STATIC_DRAW);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+	g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
 }
 
 void UtilityPipeline::blendFrames (RenderTarget* source1, RenderTarget* source2,
@@ -265,41 +265,40 @@ void UtilityPipeline::blendFrames (RenderTarget* source1, RenderTarget* source2,
 {
 	setShader(blendShader);
 
-	set("uMainSampler1", 0);
-	set("uMainSampler2", 1);
-	set("uStrength", strength);
+	set(Uniforms::MAIN_SAMPLER_1, 0);
+	set(Uniforms::MAIN_SAMPLER_2, 1);
+	set(Uniforms::STRENGTH, strength);
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, source1->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, source1->texture);
 
-	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, source2->texture);
+	g_renderer.state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, source2->texture);
 
 	if (target->texture) {
-		glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+		g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
 				GL_TEXTURE_2D, target->texture, 0);
-		glViewport(0, 0, target->width, target->height);
+		g_renderer.state.viewport(0, 0, target->width, target->height);
 	}
 	else {
-		glViewport(0, 0, source1->width, source1->height);
+		g_renderer.state.viewport(0, 0, source1->width, source1->height);
 	}
 
 	if (clearAlpha) {
-		glClearColor(0, 0, 0, 0);
+		g_renderer.state.clearColor(0, 0, 0, 0);
 	}
 	else {
-		glClearColor(0, 0, 0, 1);
+		g_renderer.state.clearColor(0, 0, 0, 1);
 	}
 
-	glClear(GL_COLOR_BUFFER_BIT);
+	g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * vertexData.size(),
 			vertexData.data(), GL_STATIC_DRAW);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	g_renderer.drawArrays(name, GL_TRIANGLES, 0, 6);
+	g_renderer.stats.addDraw(name, 6);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+	g_renderer.state.bindTexture(GL_TEXTURE_2D, 0);
 }
 
 void UtilityPipeline::blendFramesAdditive (RenderTarget* source1, RenderTarget*
@@ -310,24 +309,24 @@ void UtilityPipeline::blendFramesAdditive (RenderTarget* source1, RenderTarget*
 
 void UtilityPipeline::clearFrame (RenderTarget* target, bool clearAlpha)
 {
-	glViewport(0, 0, target->width, target->height);
+	g_renderer.state.viewport(0, 0, target->width, target->height);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
 
 	if (clearAlpha)
 	{
-		glClearColor(0, 0, 0, 0);
+		g_renderer.state.clearColor(0, 0, 0, 0);
 	}
 	else
 	{
-		glClearColor(0, 0, 0, 1);
+		g_renderer.state.clearColor(0, 0, 0, 1);
 	}
 
-	glClear(GL_COLOR_BUFFER_BIT);
+	g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 	auto &fbo = g_renderer.currentFramebuffer;
 
-	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	g_renderer.state.bindFramebuffer(GL_FRAMEBUFFER, fbo);
 }
 
 void UtilityPipeline::setUVs (double uA, double vA, double uB, double vB, double uC,
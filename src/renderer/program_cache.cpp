@@ -0,0 +1,186 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "program_cache.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "../utils/messages.hpp"
+#include "../utils/hash/fnv1a.hpp"
+
+namespace Zen {
+
+namespace {
+
+std::string GetGLString (GLenum name)
+{
+	auto *value = reinterpret_cast<const char*>(glGetString(name));
+
+	return value ? value : "";
+}
+
+}	// namespace
+
+bool ProgramCache::boot (const std::string& directory_, int maxTextures_)
+{
+	enabled = false;
+
+	if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary) {
+		MessageWarning("Program binaries are not supported, the program cache "
+				"is disabled.");
+
+		return false;
+	}
+
+	GLint formats_ = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats_);
+
+	if (formats_ == 0) {
+		MessageWarning("The driver has no program binary format, the program "
+				"cache is disabled.");
+
+		return false;
+	}
+
+	std::error_code error_;
+	std::filesystem::create_directories(directory_, error_);
+
+	if (error_) {
+		MessageWarning("Cannot create the program cache directory \"",
+				directory_, "\" : ", error_.message());
+
+		return false;
+	}
+
+	directory = directory_;
+	maxTextures = maxTextures_;
+	driver = GetGLString(GL_VENDOR) + "|" + GetGLString(GL_RENDERER) + "|"
+		+ GetGLString(GL_VERSION);
+
+	enabled = true;
+
+	return enabled;
+}
+
+std::string ProgramCache::getPath (const std::string& vertexShader_,
+		const std::string& fragmentShader_) const
+{
+	std::uint64_t hash_ = Fnv1a(driver.data(), driver.size() + 1);
+	hash_ = Fnv1a(&maxTextures, sizeof(maxTextures), hash_);
+	hash_ = Fnv1a(vertexShader_.data(), vertexShader_.size() + 1, hash_);
+	hash_ = Fnv1a(fragmentShader_.data(), fragmentShader_.size(), hash_);
+
+	char name_[32];
+	std::snprintf(name_, sizeof(name_), "%016llx.bin",
+			static_cast<unsigned long long>(hash_));
+
+	return (std::filesystem::path(directory) / name_).string();
+}
+
+GLuint ProgramCache::load (const std::string& vertexShader_,
+		const std::string& fragmentShader_)
+{
+	if (!enabled)
+		return 0;
+
+	std::string path_ = getPath(vertexShader_, fragmentShader_);
+	std::ifstream file_ (path_, std::ios::binary);
+
+	if (!file_) {
+		misses++;
+		return 0;
+	}
+
+	std::uint32_t header_[3] = {0, 0, 0};
+	file_.read(reinterpret_cast<char*>(header_), sizeof(header_));
+
+	std::vector<char> binary_;
+	if (file_ && header_[0] == MAGIC) {
+		binary_.resize(header_[2]);
+		file_.read(binary_.data(), binary_.size());
+	}
+
+	GLint linked_ = GL_FALSE;
+	GLuint program_ = 0;
+
+	if (file_ && !binary_.empty()) {
+		program_ = glCreateProgram();
+		glProgramBinary(program_, header_[1], binary_.data(), binary_.size());
+		glGetProgramiv(program_, GL_LINK_STATUS, &linked_);
+	}
+
+	file_.close();
+
+	if (!linked_) {
+		// Truncated, outdated or from another driver version, compile again
+		if (program_)
+			glDeleteProgram(program_);
+
+		std::error_code error_;
+		std::filesystem::remove(path_, error_);
+
+		misses++;
+		return 0;
+	}
+
+	hits++;
+
+	return program_;
+}
+
+void ProgramCache::save (GLuint program_, const std::string& vertexShader_,
+		const std::string& fragmentShader_)
+{
+	if (!enabled)
+		return;
+
+	GLint linked_ = GL_FALSE;
+	glGetProgramiv(program_, GL_LINK_STATUS, &linked_);
+
+	GLint length_ = 0;
+	glGetProgramiv(program_, GL_PROGRAM_BINARY_LENGTH, &length_);
+
+	if (!linked_ || length_ <= 0)
+		return;
+
+	std::vector<char> binary_(length_);
+	GLenum format_ = 0;
+	glGetProgramBinary(program_, length_, &length_, &format_, binary_.data());
+
+	std::uint32_t header_[3] = {MAGIC, static_cast<std::uint32_t>(format_),
+		static_cast<std::uint32_t>(length_)};
+
+	// Written aside then renamed, so another instance never reads half a file
+	std::string path_ = getPath(vertexShader_, fragmentShader_);
+	std::string temp_ = path_ + ".tmp";
+
+	{
+		std::ofstream file_ (temp_, std::ios::binary | std::ios::trunc);
+		file_.write(reinterpret_cast<const char*>(header_), sizeof(header_));
+		file_.write(binary_.data(), length_);
+
+		if (!file_) {
+			MessageWarning("Cannot write the program binary \"", temp_, "\"");
+
+			file_.close();
+			std::error_code error_;
+			std::filesystem::remove(temp_, error_);
+
+			return;
+		}
+	}
+
+	std::error_code error_;
+	std::filesystem::rename(temp_, path_, error_);
+
+	if (error_)
+		std::filesystem::remove(temp_, error_);
+}
+
+}	// namespace Zen
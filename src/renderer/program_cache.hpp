@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_PROGRAM_CACHE_HPP
+#define ZEN_RENDERER_PROGRAM_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <GL/glew.h>
+
+namespace Zen {
+
+/**
+ * Stores the linked shader programs on disk with `glGetProgramBinary`, and
+ * loads them back with `glProgramBinary` on the next launches instead of
+ * compiling their sources.
+ *
+ * Each binary is keyed by a hash of the shader sources, the driver that
+ * produced it and the number of texture units, as the multi pipeline
+ * generates its fragment shader for it. The driver may still reject a
+ * binary, after an update for instance, in which case the file is removed
+ * and the program is compiled as usual.
+ *
+ * It is enabled with the `RenderConfig::programCacheDirectory` option.
+ *
+ * @since 0.0.0
+ */
+class ProgramCache
+{
+public:
+	/**
+	 * Enables the cache, if the driver can give program binaries back.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param directory The directory to store the binaries in. It is created
+	 * if needed.
+	 * @param maxTextures The number of texture units the shaders are
+	 * generated for.
+	 *
+	 * @return `true` if the cache is enabled.
+	 */
+	bool boot (const std::string& directory, int maxTextures);
+
+	/**
+	 * Creates a program from its cached binary.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param vertexShader The source of the vertex shader.
+	 * @param fragmentShader The source of the fragment shader.
+	 *
+	 * @return The linked program, or 0 if there is no binary or the driver
+	 * rejected it.
+	 */
+	GLuint load (const std::string& vertexShader,
+			const std::string& fragmentShader);
+
+	/**
+	 * Stores the binary of a program linked from the given sources.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param program The linked program.
+	 * @param vertexShader The source of the vertex shader.
+	 * @param fragmentShader The source of the fragment shader.
+	 */
+	void save (GLuint program, const std::string& vertexShader,
+			const std::string& fragmentShader);
+
+	/**
+	 * Is the cache used?
+	 *
+	 * @since 0.0.0
+	 */
+	bool enabled = false;
+
+	/**
+	 * The number of programs loaded from their binary.
+	 *
+	 * @since 0.0.0
+	 */
+	int hits = 0;
+
+	/**
+	 * The number of programs that had to be compiled.
+	 *
+	 * @since 0.0.0
+	 */
+	int misses = 0;
+
+private:
+	/**
+	 * Gets the path of the binary of a program.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param vertexShader The source of the vertex shader.
+	 * @param fragmentShader The source of the fragment shader.
+	 *
+	 * @return The path of the file.
+	 */
+	std::string getPath (const std::string& vertexShader,
+			const std::string& fragmentShader) const;
+
+	/**
+	 * The magic number starting each file, also used as a version.
+	 *
+	 * @since 0.0.0
+	 */
+	static const std::uint32_t MAGIC = 0x5a505231;	// "ZPR1"
+
+	/**
+	 * The directory of the binaries.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string directory;
+
+	/**
+	 * The vendor, renderer and version strings of the driver.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string driver;
+
+	/**
+	 * The number of texture units the shaders are generated for.
+	 *
+	 * @since 0.0.0
+	 */
+	int maxTextures = 0;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "render_queue.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include "../components/depth.hpp"
+#include "../components/masked.hpp"
+#include "../components/renderable.hpp"
+#include "../components/textured.hpp"
+#include "../components/position.hpp"
+#include "../components/scale.hpp"
+#include "../components/rotation.hpp"
+#include "../components/flip.hpp"
+#include "../components/scroll_factor.hpp"
+#include "../texture/components/frame.hpp"
+#include "../texture/components/source.hpp"
+#include "../systems/blend_mode.hpp"
+#include "../systems/origin.hpp"
+#include "../systems/scroll.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+void RenderQueue::build (std::span<Entity> children, Entity camera)
+{
+	queue.clear();
+	maskIds.clear();
+	pipelineIds.clear();
+	moved = 0;
+
+	// The bits of the key that must match for two items to share a batch
+	const std::uint64_t stateMask_ = 0x0000FFFFFFFFFFFF;
+
+	int layer_ = 0;
+	int depth_ = 0;
+
+	for (size_t i = 0; i < children.size(); i++) {
+		Item item_;
+		item_.entity = children[i];
+
+		auto depthComponent_ = g_registry.try_get<Components::Depth>(
+				item_.entity);
+		int itemDepth_ = (depthComponent_) ? depthComponent_->value : 0;
+
+		if (i > 0 && itemDepth_ != depth_)
+			layer_++;
+
+		depth_ = itemDepth_;
+
+		item_.key = getKey(item_.entity, layer_);
+		item_.hasBounds = getBounds(&item_, camera);
+
+		// Look for the last item of the same batch, without jumping over an
+		// item it overlaps
+		size_t insert_ = queue.size();
+		int steps_ = 0;
+
+		for (size_t j = queue.size(); j-- > 0 && steps_ < lookBehind; steps_++) {
+			const Item &other_ = queue[j];
+
+			if ((other_.key >> 48) != (item_.key >> 48))
+				break;
+
+			if ((other_.key & stateMask_) == (item_.key & stateMask_)) {
+				insert_ = j + 1;
+				break;
+			}
+
+			if (overlaps(item_, other_))
+				break;
+		}
+
+		if (insert_ == queue.size()) {
+			queue.emplace_back(item_);
+		}
+		else {
+			queue.insert(queue.begin() + insert_, item_);
+			moved++;
+		}
+	}
+
+	for (size_t i = 0; i < queue.size(); i++)
+		children[i] = queue[i].entity;
+}
+
+std::uint64_t RenderQueue::getKey (Entity entity, int layer)
+{
+	std::uint64_t mask_ = 0;
+	std::uint64_t pipeline_ = 0;
+	std::uint64_t texture_ = 0;
+
+	auto masked_ = g_registry.try_get<Components::Masked>(entity);
+	if (masked_ && masked_->mask != entt::null) {
+		auto it_ = maskIds.emplace(masked_->mask, maskIds.size() + 1).first;
+		mask_ = it_->second;
+	}
+
+	auto renderable_ = g_registry.try_get<Components::Renderable>(entity);
+	if (renderable_ && renderable_->pipeline) {
+		auto it_ = pipelineIds.emplace(renderable_->pipeline,
+				pipelineIds.size() + 1).first;
+		pipeline_ = it_->second;
+	}
+
+	auto textured_ = g_registry.try_get<Components::Textured>(entity);
+	if (textured_ && textured_->frame != entt::null) {
+		auto frame_ = g_registry.try_get<Components::Frame>(textured_->frame);
+		auto source_ = (frame_) ?
+			g_registry.try_get<Components::TextureSource>(frame_->source)
+			: nullptr;
+
+		if (source_)
+			texture_ = source_->glTexture;
+	}
+
+	std::uint64_t blendMode_ = static_cast<std::uint64_t>(
+			GetBlendMode(entity) + 1);
+
+	return (static_cast<std::uint64_t>(layer) & 0xFFFF) << 48
+		| (mask_ & 0xFF) << 40
+		| (pipeline_ & 0xFF) << 32
+		| (blendMode_ & 0xFF) << 24
+		| (texture_ & 0xFFFFFF);
+}
+
+bool RenderQueue::getBounds (Item *item, Entity camera)
+{
+	auto [textured_, position_, scale_, rotation_] = g_registry.try_get<
+		Components::Textured, Components::Position, Components::Scale,
+		Components::Rotation>(item->entity);
+
+	if (!textured_ || !position_ || !scale_ || !rotation_
+			|| textured_->frame == entt::null)
+		return false;
+
+	auto frame_ = g_registry.try_get<Components::Frame>(textured_->frame);
+	if (!frame_)
+		return false;
+
+	double width_ = frame_->data.sourceSize.width;
+	double height_ = frame_->data.sourceSize.height;
+	double originX_ = GetDisplayOriginX(item->entity);
+	double originY_ = GetDisplayOriginY(item->entity);
+
+	// The local quad, mirrored around the origin if flipped
+	double x0_ = -originX_, x1_ = width_ - originX_;
+	double y0_ = -originY_, y1_ = height_ - originY_;
+
+	auto flip_ = g_registry.try_get<Components::Flip>(item->entity);
+	if (flip_ && flip_->x) {
+		x0_ = std::min(x0_, originX_ - width_);
+		x1_ = std::max(x1_, originX_);
+	}
+	if (flip_ && flip_->y) {
+		y0_ = std::min(y0_, originY_ - height_);
+		y1_ = std::max(y1_, originY_);
+	}
+
+	x0_ *= scale_->x;
+	x1_ *= scale_->x;
+	y0_ *= scale_->y;
+	y1_ *= scale_->y;
+
+	double cos_ = std::cos(rotation_->value);
+	double sin_ = std::sin(rotation_->value);
+
+	// Only the extents of the rotated quad on each axis are needed
+	double ax_ = std::abs(cos_), ay_ = std::abs(sin_);
+	double cx_ = (x0_ + x1_) / 2., cy_ = (y0_ + y1_) / 2.;
+	double hw_ = std::abs(x1_ - x0_) / 2., hh_ = std::abs(y1_ - y0_) / 2.;
+
+	double centerX_ = position_->x + cx_ * cos_ - cy_ * sin_;
+	double centerY_ = position_->y + cx_ * sin_ + cy_ * cos_;
+	double extentX_ = hw_ * ax_ + hh_ * ay_;
+	double extentY_ = hw_ * ay_ + hh_ * ax_;
+
+	// Follow the camera scroll as the Game Object does
+	auto scrollFactor_ = g_registry.try_get<Components::ScrollFactor>(
+			item->entity);
+	if (scrollFactor_) {
+		centerX_ -= GetScrollX(camera) * scrollFactor_->x;
+		centerY_ -= GetScrollY(camera) * scrollFactor_->y;
+	}
+	else {
+		centerX_ -= GetScrollX(camera);
+		centerY_ -= GetScrollY(camera);
+	}
+
+	item->left = centerX_ - extentX_;
+	item->right = centerX_ + extentX_;
+	item->top = centerY_ - extentY_;
+	item->bottom = centerY_ + extentY_;
+
+	return true;
+}
+
+bool RenderQueue::overlaps (const Item& a, const Item& b)
+{
+	if (!a.hasBounds || !b.hasBounds)
+		return true;
+
+	return a.left < b.right && b.left < a.right
+		&& a.top < b.bottom && b.top < a.bottom;
+}
+
+}	// namespace Zen
@@ -0,0 +1,146 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_RENDER_QUEUE_HPP
+#define ZEN_RENDERER_RENDER_QUEUE_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <map>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+class Pipeline;
+
+/**
+ * The Render Queue reorders the display list of a camera so that the Game
+ * Objects sharing the same render state are drawn next to each other, merging
+ * their batches.
+ *
+ * Each Game Object gets a 64 bit sort key holding, from the most significant
+ * bits to the least significant ones: its depth layer (16 bits), mask
+ * (8 bits), pipeline (8 bits), blend mode (8 bits) and texture (24 bits).
+ *
+ * A Game Object is only moved back to join the last Game Object with the same
+ * key, and only if it stays in the same depth layer and its screen-space
+ * bounds don't overlap any Game Object it jumps over, so the rendered image
+ * is unchanged. Game Objects whose bounds can't be computed, such as
+ * Containers or Graphics, are never jumped over.
+ *
+ * It is enabled with the `RenderConfig::batchReorder` option.
+ *
+ * @since 0.0.0
+ */
+class RenderQueue
+{
+public:
+	/**
+	 * Reorders the given display list in place.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param children The depth sorted Game Objects to render.
+	 * @param camera The Camera rendering them.
+	 */
+	void build (std::span<Entity> children, Entity camera);
+
+	/**
+	 * The maximum number of Game Objects a Game Object can jump over to join
+	 * its batch.
+	 *
+	 * @since 0.0.0
+	 */
+	int lookBehind = 64;
+
+	/**
+	 * The number of Game Objects moved by the last `build`.
+	 *
+	 * @since 0.0.0
+	 */
+	int moved = 0;
+
+private:
+	/**
+	 * A Game Object of the queue.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Item {
+		Entity entity = entt::null;
+
+		std::uint64_t key = 0;
+
+		bool hasBounds = false;
+
+		double left = 0.,
+			   top = 0.,
+			   right = 0.,
+			   bottom = 0.;
+	};
+
+	/**
+	 * Builds the sort key of a Game Object.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param entity The Game Object.
+	 * @param layer The index of its depth layer.
+	 *
+	 * @return The sort key.
+	 */
+	std::uint64_t getKey (Entity entity, int layer);
+
+	/**
+	 * Computes the bounds of a Game Object, relative to the camera scroll.
+	 *
+	 * The bounds are not transformed by the camera zoom and rotation, which
+	 * map every Game Object the same way and so don't change whether two
+	 * bounds overlap.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param item The item to fill.
+	 * @param camera The Camera rendering the Game Object.
+	 *
+	 * @return `true` if the bounds could be computed, otherwise `false`.
+	 */
+	bool getBounds (Item *item, Entity camera);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return `true` if the bounds of both items overlap, or are unknown.
+	 */
+	bool overlaps (const Item& a, const Item& b);
+
+	/**
+	 * The reordered items, kept around to reuse their storage.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Item> queue;
+
+	/**
+	 * The small ids given to the masks met during a `build`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::map<Entity, std::uint64_t> maskIds;
+
+	/**
+	 * The small ids given to the pipelines met during a `build`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::map<Pipeline*, std::uint64_t> pipelineIds;
+};
+
+}	// namespace Zen
+
+#endif
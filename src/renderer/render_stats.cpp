@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "render_stats.hpp"
+
+namespace Zen {
+
+void RenderStats::reset ()
+{
+	drawCalls = 0;
+	vertices = 0;
+	flushes = 0;
+	flushReasons.fill(0);
+
+	// Keep the entries, and their storage, as the same pipelines draw every
+	// frame
+	for (auto& p_ : pipelines) {
+		p_.drawCalls = 0;
+		p_.vertices = 0;
+		p_.flushes = 0;
+	}
+
+	textureBinds = 0;
+	programSwitches = 0;
+	framebufferSwitches = 0;
+	stencilPushes = 0;
+	stencilPops = 0;
+	scissorMasks = 0;
+	bitmapCacheUpdates = 0;
+	computedSprites = 0;
+	cachedSprites = 0;
+
+	flushReason = FLUSH_REASON::OTHER;
+}
+
+PipelineStats& RenderStats::getPipeline (const std::string& pipeline_)
+{
+	for (auto& p_ : pipelines) {
+		if (p_.name == pipeline_)
+			return p_;
+	}
+
+	pipelines.push_back({pipeline_});
+
+	return pipelines.back();
+}
+
+void RenderStats::addDraw (const std::string& pipeline_, int vertexCount_)
+{
+	auto& p_ = getPipeline(pipeline_);
+
+	p_.drawCalls++;
+	p_.vertices += vertexCount_;
+
+	drawCalls++;
+	vertices += vertexCount_;
+}
+
+void RenderStats::addFlush (const std::string& pipeline_, int vertexCount_)
+{
+	addDraw(pipeline_, vertexCount_);
+
+	getPipeline(pipeline_).flushes++;
+
+	flushes++;
+	flushReasons[static_cast<int>(flushReason)]++;
+
+	flushReason = FLUSH_REASON::OTHER;
+}
+
+int RenderStats::getFlushes (FLUSH_REASON reason_) const
+{
+	return flushReasons[static_cast<int>(reason_)];
+}
+
+}	// namespace Zen
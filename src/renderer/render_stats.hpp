@@ -0,0 +1,226 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_RENDER_STATS_HPP
+#define ZEN_RENDERER_RENDER_STATS_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+#include "../enums/flush_reason.hpp"
+
+namespace Zen {
+
+/**
+ * The work submitted by a pipeline during a frame.
+ *
+ * @struct PipelineStats
+ * @since 0.0.0
+ */
+struct PipelineStats
+{
+	/**
+	 * The name of the pipeline.
+	 *
+	 * @since 0.0.0
+	 */
+	std::string name;
+
+	/**
+	 * The number of draw calls.
+	 *
+	 * @since 0.0.0
+	 */
+	int drawCalls = 0;
+
+	/**
+	 * The number of vertices drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	int vertices = 0;
+
+	/**
+	 * The number of batches flushed.
+	 *
+	 * @since 0.0.0
+	 */
+	int flushes = 0;
+};
+
+/**
+ * The work done by the Renderer during a frame.
+ *
+ * The Renderer fills it while rendering, and it is complete when the
+ * `post-render` event is emitted. See `Renderer::getStats`.
+ *
+ * @struct RenderStats
+ * @since 0.0.0
+ */
+struct RenderStats
+{
+	/**
+	 * The number of draw calls.
+	 *
+	 * @since 0.0.0
+	 */
+	int drawCalls = 0;
+
+	/**
+	 * The number of vertices drawn.
+	 *
+	 * @since 0.0.0
+	 */
+	int vertices = 0;
+
+	/**
+	 * The number of batches flushed.
+	 *
+	 * @since 0.0.0
+	 */
+	int flushes = 0;
+
+	/**
+	 * The number of flushes for each reason, indexed by `FLUSH_REASON`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::array<int, static_cast<int>(FLUSH_REASON::COUNT)> flushReasons {};
+
+	/**
+	 * The work of each pipeline, in the order they first drew.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<PipelineStats> pipelines;
+
+	/**
+	 * The number of textures bound.
+	 *
+	 * @since 0.0.0
+	 */
+	int textureBinds = 0;
+
+	/**
+	 * The number of programs used.
+	 *
+	 * @since 0.0.0
+	 */
+	int programSwitches = 0;
+
+	/**
+	 * The number of framebuffers bound.
+	 *
+	 * @since 0.0.0
+	 */
+	int framebufferSwitches = 0;
+
+	/**
+	 * The number of stencil masks pushed.
+	 *
+	 * @since 0.0.0
+	 */
+	int stencilPushes = 0;
+
+	/**
+	 * The number of stencil masks popped.
+	 *
+	 * @since 0.0.0
+	 */
+	int stencilPops = 0;
+
+	/**
+	 * The number of geometry masks applied with the scissor instead of the
+	 * stencil buffer.
+	 *
+	 * @since 0.0.0
+	 */
+	int scissorMasks = 0;
+
+	/**
+	 * The number of containers cached as bitmap whose children were drawn
+	 * again.
+	 *
+	 * @since 0.0.0
+	 */
+	int bitmapCacheUpdates = 0;
+
+	/**
+	 * The number of sprites whose vertices were computed.
+	 *
+	 * @since 0.0.0
+	 */
+	int computedSprites = 0;
+
+	/**
+	 * The number of sprites whose vertices were taken from their vertex
+	 * cache.
+	 *
+	 * @since 0.0.0
+	 */
+	int cachedSprites = 0;
+
+	/**
+	 * The reason of the next flush, set by the code requesting it.
+	 *
+	 * @since 0.0.0
+	 */
+	FLUSH_REASON flushReason = FLUSH_REASON::OTHER;
+
+	/**
+	 * Clears all the counters.
+	 *
+	 * @since 0.0.0
+	 */
+	void reset ();
+
+	/**
+	 * Counts a draw call.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param pipeline The name of the pipeline drawing.
+	 * @param vertexCount The number of vertices drawn.
+	 */
+	void addDraw (const std::string& pipeline, int vertexCount);
+
+	/**
+	 * Counts a flush and its draw call, with the current `flushReason`, and
+	 * resets that reason.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param pipeline The name of the pipeline flushing.
+	 * @param vertexCount The number of vertices drawn.
+	 */
+	void addFlush (const std::string& pipeline, int vertexCount);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param reason A flush reason.
+	 *
+	 * @return The number of flushes for this reason.
+	 */
+	int getFlushes (FLUSH_REASON reason) const;
+
+private:
+	/**
+	 * Gets the stats of a pipeline, adding them if needed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param pipeline The name of the pipeline.
+	 *
+	 * @return The stats of the pipeline.
+	 */
+	PipelineStats& getPipeline (const std::string& pipeline);
+};
+
+}	// namespace Zen
+
+#endif
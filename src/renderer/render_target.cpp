@@ -86,27 +86,27 @@ void RenderTarget::bind (bool adjustViewport_, int width_, int height_)
 		adjustViewport();
 
 	if (autoClear) {
-		glClearColor(0.f, 0.f, 0.f, 0.f);
-		glClear(GL_COLOR_BUFFER_BIT);
+		g_renderer.state.clearColor(0.f, 0.f, 0.f, 0.f);
+		g_renderer.clear(GL_COLOR_BUFFER_BIT);
 	}
 }
 
 void RenderTarget::adjustViewport ()
 {
-	glViewport(0, 0, width, height);
+	g_renderer.state.viewport(0, 0, width, height);
 
-	glDisable(GL_SCISSOR_TEST);
+	g_renderer.state.disable(GL_SCISSOR_TEST);
 }
 
 void RenderTarget::clear ()
 {
 	g_renderer.pushFramebuffer(framebuffer);
 
-	glDisable(GL_SCISSOR_TEST);
+	g_renderer.state.disable(GL_SCISSOR_TEST);
 
-	glClearColor(0.f, 0.f, 0.f, 0.f);
+	g_renderer.state.clearColor(0.f, 0.f, 0.f, 0.f);
 
-	glClear(GL_COLOR_BUFFER_BIT);
+	g_renderer.clear(GL_COLOR_BUFFER_BIT);
 
 	g_renderer.popFramebuffer();
 
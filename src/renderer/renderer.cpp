@@ -49,12 +49,15 @@
 #include "../systems/mask.hpp"
 #include "../systems/type.hpp"
 #include "../systems/renderable.hpp"
+#include "../gameobjects/render_functions.hpp"
 #include "../display/color.hpp"
 #include "../texture/systems/frame.hpp"
 #include "../texture/components/frame.hpp"
 #include "../texture/components/source.hpp"
 #include "../components/mask.hpp"
 #include "../components/masked.hpp"
+#include "../components/opaque.hpp"
+#include "../components/renderable.hpp"
 #include "../cameras/2d/systems/camera.hpp"
 #include "../text/text_manager.hpp"
 
@@ -607,6 +610,19 @@ Renderer::~Renderer ()
 		SDL_FreeSurface(snapshotState.surface);
 }
 
+void Renderer::destroy ()
+{
+	snapshots.destroy();
+
+	recorder.destroy();
+
+	if (quadIndexBuffer) {
+		state.deleteBuffer(quadIndexBuffer);
+		glDeleteBuffers(1, &quadIndexBuffer);
+		quadIndexBuffer = 0;
+	}
+}
+
 void Renderer::boot (RenderConfig config_)
 {
 	config = config_;
@@ -614,8 +630,9 @@ void Renderer::boot (RenderConfig config_)
 	// Create the supported blend modes
 	createBlendModes();
 
-	glClearColor(config.backgroundColor.gl[0], config.backgroundColor.gl[1],
-			config.backgroundColor.gl[2], config.backgroundColor.gl[3]);
+	state.clearColor(config.backgroundColor.gl[0],
+			config.backgroundColor.gl[1], config.backgroundColor.gl[2],
+			config.backgroundColor.gl[3]);
 
 	// Mipmaps
 	mipmapFilter = config.mipmapFilter;
@@ -623,28 +640,62 @@ void Renderer::boot (RenderConfig config_)
 	if (config.maxTextures < 0)
 		config.maxTextures = 16;
 
+	recordCommands = (config.backend == RENDER_BACKEND::RECORD);
+
+	if (recordCommands)
+		state.log = &commands;
+
+	// Nothing would be drawn to measure
+	if (config.gpuTimers && !recordCommands)
+		gpuTimer.boot();
+
+	if (config.opaquePass) {
+		GLint depthBits_ = 0;
+		state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+		glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH,
+				GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE, &depthBits_);
+
+		if (depthBits_ == 0) {
+			MessageWarning("The window has no depth buffer, the opaque pass is "
+					"disabled.");
+
+			config.opaquePass = false;
+		}
+	}
+
+	// Give the last units to the texture arrays
+	if (config.textureArrays) {
+		int arrayUnits_ = std::min(4, maxTextures / 4);
+		maxTextures -= arrayUnits_;
+
+		textureArrays.boot(maxTextures, arrayUnits_, config.textureArrayLayers,
+				config.textureArrayMaxSize);
+	}
+
 	// Temporary textures
 	const std::uint8_t pixel[4] = {0, 0, 255, 255};
 	for (int i = 0; i < config.maxTextures; i++) {
 		GL_texture tmp;
 		glGenTextures(1, &tmp);
 
-		glActiveTexture(GL_TEXTURE0 + i);
+		state.activeTexture(GL_TEXTURE0 + i);
 
-		glBindTexture(GL_TEXTURE_2D, tmp);
+		state.bindTexture(GL_TEXTURE_2D, tmp);
 
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA,
 				GL_UNSIGNED_BYTE, (void*)pixel);
 
 		tempTextures.push_back(tmp);
 
-		textureIndexes.push_back(i);
+		// The units past `maxTextures` belong to the texture arrays
+		if (i < maxTextures)
+			textureIndexes.push_back(i);
 	}
 
 	// Reset to texture 1 (Texture 0 is reserved for framebuffers)
 	currentActiveTexture = 1;
 	startActiveTexture++;
-	glActiveTexture(GL_TEXTURE1);
+	state.activeTexture(GL_TEXTURE1);
 
 	setBlendMode(BLEND_MODE::BLEND);
 
@@ -653,14 +704,21 @@ void Renderer::boot (RenderConfig config_)
 
 	isBooted = true;
 
+	if (config.batchThreads > 0)
+		workers.start(config.batchThreads);
+
 	renderTarget = std::make_unique<RenderTarget>(width, height, 1, 0, true, true);
 
+	// Must be ready before the pipelines compile their shaders
+	if (!config.programCacheDirectory.empty())
+		programCache.boot(config.programCacheDirectory, maxTextures);
+
 	// Setup pipelines
 	pipelines.boot();
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	state.bindFramebuffer(GL_FRAMEBUFFER, 0);
 
-	glEnable(GL_SCISSOR_TEST);
+	state.enable(GL_SCISSOR_TEST);
 
 	g_scale.on("resize", &Renderer::onResize, this);
 
@@ -702,6 +760,40 @@ RenderTarget* Renderer::endCapture ()
 	return renderTarget.get();
 }
 
+void Renderer::pushRenderTexture (GL_fbo framebuffer_, int width_,
+		int height_)
+{
+	ZEN_ASSERT(framebuffer_ != currentFramebuffer,
+			"The Render Texture is already being drawn to.");
+
+	flush();
+
+	pushFramebuffer(framebuffer_, false, false, true);
+
+	state.disable(GL_SCISSOR_TEST);
+
+	renderTextureStack.push_back({width_, height_});
+
+	// The other pipelines update their projection when they are set
+	if (pipelines.current)
+		pipelines.current->updateProjectionMatrix();
+}
+
+void Renderer::popRenderTexture ()
+{
+	flush();
+
+	renderTextureStack.pop_back();
+
+	popFramebuffer(false, false, true);
+
+	if (renderTextureStack.empty())
+		state.enable(GL_SCISSOR_TEST);
+
+	if (pipelines.current)
+		pipelines.current->updateProjectionMatrix();
+}
+
 void Renderer::resize (int width_, int height_)
 {
 	width = width_;
@@ -709,9 +801,11 @@ void Renderer::resize (int width_, int height_)
 
 	setProjectionMatrix(width, height);
 
-	glViewport(g_scale.displayOffset.x, g_scale.displayOffset.y, width, height);
+	state.viewport(g_scale.displayOffset.x, g_scale.displayOffset.y, width,
+			height);
 
-	glScissor(g_scale.displayOffset.x, g_scale.displayOffset.y, width, height);
+	state.scissor(g_scale.displayOffset.x, g_scale.displayOffset.y, width,
+			height);
 
 	defaultScissor[0] = g_scale.displayOffset.x;
 	defaultScissor[1] = g_scale.displayOffset.y;
@@ -745,9 +839,9 @@ void Renderer::resetProjectionMatrix ()
 	projectionMatrix = glm::ortho(0.f, (float)width, (float)height, 0.f);
 }
 
-void Renderer::flush ()
+void Renderer::flush (FLUSH_REASON reason_)
 {
-	pipelines.flush();
+	pipelines.flush(reason_);
 }
 
 std::array<int, 4> Renderer::pushScissor (int x_, int y_, int width_, int height_)
@@ -782,13 +876,13 @@ void Renderer::setScissor (int x_, int y_, int width_, int height_)
 
 		// Flip y axis
 		y_ = g_window.height() - y_ - height_;
-		glScissor(x_, y_, width_, height_);
+		state.scissor(x_, y_, width_, height_);
 	}
 }
 
 void Renderer::resetScissor ()
 {
-	glEnable(GL_SCISSOR_TEST);
+	state.enable(GL_SCISSOR_TEST);
 
 	if (currentScissor[2] > 0) {
 		int cx_ = currentScissor[0];
@@ -797,7 +891,7 @@ void Renderer::resetScissor ()
 		int ch_ = currentScissor[3];
 
 		if (cw_ > 0 && ch_ > 0) {
-			glScissor(cx_, cy_, cw_, ch_);
+			state.scissor(cx_, cy_, cw_, ch_);
 		}
 	}
 }
@@ -843,7 +937,8 @@ bool Renderer::hasActiveStencilMask ()
 
 void Renderer::resetViewport ()
 {
-	glViewport(g_scale.displayOffset.x, g_scale.displayOffset.y, width, height);
+	state.viewport(g_scale.displayOffset.x, g_scale.displayOffset.y, width,
+			height);
 }
 
 bool Renderer::setBlendMode (int modeId_, bool force_)
@@ -851,20 +946,21 @@ bool Renderer::setBlendMode (int modeId_, bool force_)
 	BlendMode blendMode = blendModes[modeId_];
 
 	if (force_ || (modeId_ != -1 && currentBlendMode != modeId_)) {
-		flush();
+		flush(FLUSH_REASON::BLEND);
 
-		glEnable(GL_BLEND);
+		state.enable(GL_BLEND);
 		if (blendMode.equation.size() == 1)
-			glBlendEquation(blendMode.equation[0]);
+			state.blendEquation(blendMode.equation[0], blendMode.equation[0]);
 		else
-			glBlendEquationSeparate(blendMode.equation[0], blendMode.equation[1]);
+			state.blendEquation(blendMode.equation[0], blendMode.equation[1]);
 
 		if (blendMode.func.size() == 4) {
-			glBlendFuncSeparate(blendMode.func[0], blendMode.func[1],
+			state.blendFunc(blendMode.func[0], blendMode.func[1],
 					blendMode.func[2], blendMode.func[3]);
 		}
 		else {
-			glBlendFunc(blendMode.func[0], blendMode.func[1]);
+			state.blendFunc(blendMode.func[0], blendMode.func[1],
+					blendMode.func[0], blendMode.func[1]);
 		}
 
 		currentBlendMode = modeId_;
@@ -930,6 +1026,27 @@ int Renderer::setTextureSource (Entity textureSource_)
 		return 0;
 	}
 
+	// Packed sources share the unit of their texture array
+	if (source_->glArray >= 0 && pipelines.current
+			&& pipelines.current->textureArrays) {
+		int id_ = textureArrays.bind(textureSource_, startActiveTexture);
+
+		if (id_ == 0) {
+			// We're out of array units, so flush the batch and start over
+			flush(FLUSH_REASON::TEXTURE_UNITS);
+
+			startActiveTexture++;
+			textureFlush++;
+			currentActiveTexture = 1;
+
+			id_ = textureArrays.bind(textureSource_, startActiveTexture);
+		}
+
+		isTextureClean = false;
+
+		return id_;
+	}
+
 	// Has this source not been set already for this batch?
 	if (source_->glIndexCounter < startActiveTexture) {
 		source_->glIndexCounter = startActiveTexture;
@@ -937,14 +1054,14 @@ int Renderer::setTextureSource (Entity textureSource_)
 		if (currentActiveTexture < maxTextures) {
 			source_->glIndex = currentActiveTexture;
 
-			glActiveTexture(GL_TEXTURE0 + currentActiveTexture);
-			glBindTexture(GL_TEXTURE_2D, source_->glTexture);
+			state.bindTexture(GL_TEXTURE0 + currentActiveTexture, GL_TEXTURE_2D,
+					source_->glTexture);
 
 			currentActiveTexture++;
 		}
 		else {
 			// We're out of textures, so flush the batch and reset back to 0
-			flush();
+			flush(FLUSH_REASON::TEXTURE_UNITS);
 
 			startActiveTexture++;
 			textureFlush++;
@@ -952,8 +1069,7 @@ int Renderer::setTextureSource (Entity textureSource_)
 			source_->glIndexCounter = startActiveTexture;
 			source_->glIndex = 1;
 
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_2D, source_->glTexture);
+			state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, source_->glTexture);
 
 			currentActiveTexture = 2;
 		}
@@ -975,8 +1091,7 @@ void Renderer::setTextureZero (GL_texture texture_, bool flush_)
 		if (flush_)
 			flush();
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, texture_);
+		state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, texture_);
 
 		textureZero = texture_;
 	}
@@ -990,8 +1105,7 @@ void Renderer::clearTextureZero ()
 void Renderer::setNormalMap (GL_texture texture_)
 {
 	if (normalTexture != texture_) {
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, texture_);
+		state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, texture_);
 
 		normalTexture = texture_;
 
@@ -1012,8 +1126,7 @@ void Renderer::clearNormalMap ()
 void Renderer::unbindTextures ()
 {
 	for (size_t i = 0; i < tempTextures.size(); i++) {
-		glActiveTexture(GL_TEXTURE0 + i);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		state.bindTexture(GL_TEXTURE0 + i, GL_TEXTURE_2D, 0);
 	}
 
 	normalTexture = 0;
@@ -1035,21 +1148,17 @@ void Renderer::resetTextures (bool all)
 
 	if (all) {
 		for (size_t i = 0; i < tempTextures.size(); i++) {
-			glActiveTexture(GL_TEXTURE0 + i);
-			glBindTexture(GL_TEXTURE_2D, tempTextures[i]);
+			state.bindTexture(GL_TEXTURE0 + i, GL_TEXTURE_2D, tempTextures[i]);
 		}
 
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, tempTextures[1]);
+		state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, tempTextures[1]);
 
 		isTextureClean = true;
 	}
 	else {
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, tempTextures[0]);
+		state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, tempTextures[0]);
 
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, tempTextures[1]);
+		state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, tempTextures[1]);
 	}
 
 	normalTexture = 0;
@@ -1076,15 +1185,15 @@ int Renderer::setTexture2D (GL_texture texture_)
 		if (currentActiveTexture < maxTextures) {
 			info_.glIndex = currentActiveTexture;
 
-			glActiveTexture(GL_TEXTURE0 + currentActiveTexture);
-			glBindTexture(GL_TEXTURE_2D, texture_);
+			state.bindTexture(GL_TEXTURE0 + currentActiveTexture, GL_TEXTURE_2D,
+					texture_);
 
 			currentActiveTexture++;
 		}
 		else {
 			// We're out of textures, so flush the batch and reset back to 1
 			// (0 is reserved for fbos)
-			flush();
+			flush(FLUSH_REASON::TEXTURE_UNITS);
 
 			startActiveTexture++;
 
@@ -1093,8 +1202,7 @@ int Renderer::setTexture2D (GL_texture texture_)
 			info_.glIndexCounter = startActiveTexture;
 			info_.glIndex = 1;
 
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_2D, texture_);
+			state.bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, texture_);
 
 			currentActiveTexture = 2;
 		}
@@ -1133,10 +1241,10 @@ void Renderer::setFramebuffer (GL_fbo framebuffer_, bool updateScissor_,
 		flush();
 	}
 
-	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+	state.bindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
 
 	if (setViewport_)
-		glViewport(0, 0, width_, height_);
+		state.viewport(0, 0, width_, height_);
 
 	if (updateScissor_) {
 		if (framebuffer_)
@@ -1171,9 +1279,9 @@ GL_fbo Renderer::popFramebuffer (bool updateScissor, bool resetTextures,
 bool Renderer::setProgram (GL_program program_)
 {
 	if (program_ != currentProgram) {
-		flush();
+		flush(FLUSH_REASON::PIPELINE);
 
-		glUseProgram(program_);
+		state.useProgram(program_);
 
 		currentProgram = program_;
 
@@ -1185,7 +1293,7 @@ bool Renderer::setProgram (GL_program program_)
 
 void Renderer::resetProgram ()
 {
-	glUseProgram(currentProgram);
+	state.useProgram(currentProgram);
 }
 
 GL_texture Renderer::createTextureFromSource (Entity source_, int width_,
@@ -1226,6 +1334,11 @@ GL_texture Renderer::createTextureFromSource (Entity source_, int width_,
 		// Create the texture
 		texture_ = createTexture2D(0, minFilter_, magFilter_, wrap_, wrap_,
 				format_[0], src_->tmp);
+
+		// Also pack it in a texture array, for the Multi Pipeline
+		if (config.textureArrays)
+			textureArrays.add(source_, src_->tmp, format_[0], minFilter_,
+					magFilter_);
 	}
 
 	return texture_;
@@ -1238,13 +1351,12 @@ GL_texture Renderer::createTexture2D (int mipLevel_, GLenum minFilter_,
 	GL_texture texture_;
 	glGenTextures(1, &texture_);
 
-	glActiveTexture(GL_TEXTURE0);
+	state.activeTexture(GL_TEXTURE0);
 
 	// Keep current texture to reset it when done
-	GL_texture currentTexture_ = 0;
-	glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&currentTexture_);
+	GL_texture currentTexture_ = state.getTexture2D();
 
-	glBindTexture(GL_TEXTURE_2D, texture_);
+	state.bindTexture(GL_TEXTURE_2D, texture_);
 
 	// Set wrapping options on the currently bound texture
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS_);
@@ -1272,7 +1384,7 @@ GL_texture Renderer::createTexture2D (int mipLevel_, GLenum minFilter_,
 		glGenerateMipmap(GL_TEXTURE_2D);
 
 	if (currentTexture_)
-		glBindTexture(GL_TEXTURE_2D, currentTexture_);
+		state.bindTexture(GL_TEXTURE_2D, currentTexture_);
 
 	textureInfo[texture_] = {
 		.isRenderTexture = false,
@@ -1285,6 +1397,59 @@ GL_texture Renderer::createTexture2D (int mipLevel_, GLenum minFilter_,
 	return texture_;
 }
 
+void Renderer::updateTexture2D (GL_texture texture_, int x_, int y_,
+		SDL_Surface* surface_)
+{
+	state.activeTexture(GL_TEXTURE0);
+
+	// Keep current texture to reset it when done
+	GL_texture currentTexture_ = state.getTexture2D();
+
+	state.bindTexture(GL_TEXTURE_2D, texture_);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, surface_->pitch / 4);
+
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x_, y_, surface_->w, surface_->h,
+			GL_RGBA, GL_UNSIGNED_BYTE, surface_->pixels);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+	if (currentTexture_)
+		state.bindTexture(GL_TEXTURE_2D, currentTexture_);
+}
+
+const GpuTimingReport& Renderer::getGpuTimings () const
+{
+	return gpuTimer.getReport();
+}
+
+const RenderStats& Renderer::getStats () const
+{
+	return lastStats;
+}
+
+const CommandLog& Renderer::getCommandLog () const
+{
+	return commands;
+}
+
+void Renderer::clear (GLbitfield mask_)
+{
+	if (recordCommands)
+		commands.recordClear(mask_);
+	else
+		glClear(mask_);
+}
+
+void Renderer::drawArrays (const std::string& name_, GLenum topology_,
+		GLint first_, GLsizei count_)
+{
+	if (recordCommands)
+		commands.recordDraw(name_, topology_, first_, count_);
+	else
+		glDrawArrays(topology_, first_, count_);
+}
+
 GL_fbo Renderer::createFramebuffer (int width_, int height_,
 		GL_texture renderTexture_, bool addDepthStencilBuffer_)
 {
@@ -1348,7 +1513,7 @@ GL_vao Renderer::createVertexArray ()
 	GL_vao vertexArray;
 
 	glGenVertexArrays(1, &vertexArray);
-	glBindVertexArray(vertexArray);
+	state.bindVertexArray(vertexArray);
 	currentVertexArray = vertexArray;
 
 	return vertexArray;
@@ -1359,7 +1524,7 @@ GL_vbo Renderer::createVertexBuffer (size_t initialSize, GLenum bufferUsage)
 	GL_vbo vertexBuffer;
 
 	glGenBuffers(1, &vertexBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	state.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
 	glBufferData(GL_ARRAY_BUFFER, initialSize, nullptr, bufferUsage);
 
 	return vertexBuffer;
@@ -1371,7 +1536,7 @@ GL_vbo Renderer::createVertexBuffer (std::vector<std::uint8_t> initialData,
 	GL_vbo vertexBuffer;
 
 	glGenBuffers(1, &vertexBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	state.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(std::uint8_t) * initialData.size(),
 			initialData.data(), bufferUsage);
 
@@ -1383,9 +1548,9 @@ GL_ibo Renderer::createIndexBuffer (size_t initialSize, GLenum bufferUsage)
 	GL_vbo indexBuffer;
 
 	glGenBuffers(1, &indexBuffer);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, initialSize, nullptr, bufferUsage);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 	return indexBuffer;
 }
@@ -1396,21 +1561,57 @@ GL_ibo Renderer::createIndexBuffer (std::vector<std::uint8_t> initialData,
 	GL_vbo indexBuffer;
 
 	glGenBuffers(1, &indexBuffer);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(std::uint8_t) *
 			initialData.size(), initialData.data(), bufferUsage);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 	return indexBuffer;
 }
 
+GL_ibo Renderer::getQuadIndexBuffer (int quads_)
+{
+	if (quads_ <= quadIndexCapacity)
+		return quadIndexBuffer;
+
+	GLuint count_ = static_cast<GLuint>(quads_) * 6;
+	std::vector<std::uint8_t> data_(count_ * sizeof(GLuint));
+	GLuint *indices_ = reinterpret_cast<GLuint*>(data_.data());
+
+	for (GLuint i = 0, v = 0; i < count_; i += 6, v += 4) {
+		indices_[i + 0] = v + 0;
+		indices_[i + 1] = v + 1;
+		indices_[i + 2] = v + 2;
+		indices_[i + 3] = v + 0;
+		indices_[i + 4] = v + 2;
+		indices_[i + 5] = v + 3;
+	}
+
+	if (!quadIndexBuffer) {
+		quadIndexBuffer = createIndexBuffer(data_, GL_STATIC_DRAW);
+	}
+	else {
+		// Grow in place so the vertex arrays referencing it stay valid
+		state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, data_.size(), data_.data(),
+				GL_STATIC_DRAW);
+		state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	}
+
+	quadIndexCapacity = quads_;
+
+	return quadIndexBuffer;
+}
+
 void Renderer::deleteTexture (GL_texture texture_, bool reset_)
 {
 	if (reset_)
 		resetTextures(true);
 
-	if (texture_)
+	if (texture_) {
+		state.deleteTexture(texture_);
 		glDeleteTextures(1, &texture_);
+	}
 
 	auto it_ = textureInfo.find(texture_);
 	if (it_ != textureInfo.end())
@@ -1422,31 +1623,32 @@ void Renderer::deleteFramebuffer (GL_fbo framebuffer_)
 	if (!framebuffer_)
 		return;
 
-	// Remove from the stack
-	bool removed = false;
+	auto info_ = framebufferInfo.find(framebuffer_);
+
+	// Framebuffer not found
+	if (info_ == framebufferInfo.end())
+		return;
+
+	// Remove from the stack, if it is still bound
 	for (size_t i = 0; i < fboStack.size(); i++) {
 		GL_fbo fbo_ = fboStack[i];
 
 		if (fbo_ == framebuffer_) {
 			fboStack.erase(fboStack.begin() + i);
-			removed = true;
 			break;
 		}
 	}
 
-	// Framebuffer not found
-	if (!removed)
-		return;
-
 	// Delete buffers (Color buffer texture needs to be deleted manually)
+	state.deleteFramebuffer(framebuffer_);
 	glDeleteFramebuffers(1, &framebuffer_);
-	glDeleteRenderbuffers(1, &framebufferInfo[framebuffer_].renderBuffer);
+	glDeleteRenderbuffers(1, &info_->second.renderBuffer);
 
 	if (currentFramebuffer == framebuffer_)
 		currentFramebuffer = 0;
 
 	// Delete info about framebuffer
-	framebufferInfo.erase(framebufferInfo.find(framebuffer_));
+	framebufferInfo.erase(info_);
 }
 
 void Renderer::deleteProgram (GL_program program)
@@ -1457,6 +1659,7 @@ void Renderer::deleteProgram (GL_program program)
 
 void Renderer::deleteBuffer (GLuint buffer)
 {
+	state.deleteBuffer(buffer);
 	glDeleteBuffers(1, &buffer);
 }
 
@@ -1581,20 +1784,33 @@ void Renderer::postRenderCamera (Entity camera) {
 
 void Renderer::preRender ()
 {
+	commands.clear();
+	state.beginFrame();
+	stats.reset();
+
+	// Invoke the callbacks of the snapshots that are ready
+	snapshots.update();
+
+	if (gpuTimer.beginFrame()) {
+		const GpuTimingReport *report_ = &gpuTimer.getReport();
+		emit(Events::RENDER_GPU_TIMINGS, report_);
+	}
+
 	// Make sure we are bound to the main framebuffer
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	state.bindFramebuffer(GL_FRAMEBUFFER, 0);
 
-	glDisable(GL_SCISSOR_TEST);
+	state.disable(GL_SCISSOR_TEST);
 
 	if (config.clearBeforeRender) {
 		Color clearColor = config.backgroundColor;
 
-		glClearColor(clearColor.gl[0], clearColor.gl[1], clearColor.gl[2], clearColor.gl[3]);
+		state.clearColor(clearColor.gl[0], clearColor.gl[1], clearColor.gl[2],
+				clearColor.gl[3]);
 
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+		clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 	}
 
-	glEnable(GL_SCISSOR_TEST);
+	state.enable(GL_SCISSOR_TEST);
 
 	for (int i = 0; i < 4; i++)
 		currentScissor[i] = defaultScissor[i];
@@ -1603,7 +1819,7 @@ void Renderer::preRender ()
 	scissorStack.push_back(currentScissor);
 
 	if (g_scene.customViewports) {
-		glScissor(0, 0, width, height);
+		state.scissor(0, 0, width, height);
 	}
 
 	currentMask.mask = entt::null;
@@ -1945,7 +2161,7 @@ public:
 };
 std::unique_ptr<TestPipeline> test = nullptr;
 
-void Renderer::render (std::vector<Entity> children_, Entity camera_)
+void Renderer::render (std::span<Entity> children_, Entity camera_)
 {
 	emit("render", camera_);
 
@@ -1962,10 +2178,51 @@ void Renderer::render (std::vector<Entity> children_, Entity camera_)
 		return;
 	}
 
+	// Group the Game Objects sharing the same state, if enabled
+	if (config.batchReorder)
+		renderQueue.build(children_, camera_);
+
+	// Draw the opaque Game Objects first, front to back
+	if (config.opaquePass)
+		opaquePass = drawOpaque(children_, camera_);
+
 	// Reset the current type
-	currentType = "";
+	currentType = 0;
 
 	for (size_t i = 0; i < children_.size(); i++) {
+		if (opaquePass) {
+			if (childOpaque[i])
+				continue;
+
+			setDepth(childDepths[i]);
+		}
+
+		// Batch the runs of plain Sprites together, so their corners are
+		// transformed at once, and on the worker threads if any
+		size_t end_ = getSpriteRunEnd(children_, i);
+
+		if (end_ > i) {
+			if (currentMask.mask != entt::null) {
+				PostRenderMask(currentMask.mask, currentMask.camera);
+			}
+
+			int bm_ = GetBlendMode(children_[i]);
+			if (bm_ != currentBlendMode)
+				setBlendMode(bm_);
+
+			auto spriteRun_ = children_.subspan(i, end_ - i);
+
+			for (auto child_ : spriteRun_)
+				AddToRenderList(camera_, child_);
+
+			pipelines.MULTI_PIPELINE->batchSprites(spriteRun_, camera_);
+
+			currentType = GetTypeId(spriteRun_.back());
+			i = end_ - 1;
+
+			continue;
+		}
+
 		finalType = (i == (children_.size() - 1));
 
 		Entity child_ = children_[i];
@@ -1985,13 +2242,14 @@ void Renderer::render (std::vector<Entity> children_, Entity camera_)
 		if (bm_ != currentBlendMode)
 			setBlendMode(bm_);
 
-		if (GetType(child_) != currentType) {
+		int type_ = GetTypeId(child_);
+		if (type_ != currentType) {
 			newType = true;
-			currentType = GetType(child_);
+			currentType = type_;
 		}
 
 		if (!finalType)
-			nextTypeMatch = (GetType(children_[i+1]) == currentType);
+			nextTypeMatch = (GetTypeId(children_[i+1]) == currentType);
 		else
 			nextTypeMatch = false;
 
@@ -2006,27 +2264,204 @@ void Renderer::render (std::vector<Entity> children_, Entity camera_)
 		PostRenderMask(currentMask.mask, currentMask.camera);
 	}
 
+	if (opaquePass) {
+		setDepth(0.f);
+
+		state.disable(GL_DEPTH_TEST);
+		state.depthMask(true);
+
+		opaquePass = false;
+	}
+
 	setBlendMode(BLEND_MODE::BLEND);
 
 	// Applies camera effects and pops the scissor, if set
 	postRenderCamera(camera_);
 }
 
-void Renderer::postRender ()
+size_t Renderer::getSpriteRunEnd (std::span<const Entity> children_,
+		size_t first_)
+{
+	int blendMode_ = -1;
+	size_t i = first_;
+
+	for (; i < children_.size(); i++) {
+		auto [renderable_, masked_] = g_registry.try_get<
+			Components::Renderable, Components::Masked>(children_[i]);
+
+		if (!renderable_ || renderable_->render != &Render_image
+				|| renderable_->pipeline != pipelines.MULTI_PIPELINE
+				|| !renderable_->postPipelines.empty()
+				|| (masked_ && masked_->mask != entt::null))
+			break;
+
+		// They are drawn in the opaque pass, and the depth changes after them
+		if (opaquePass && childOpaque[i])
+			break;
+
+		int bm_ = GetBlendMode(children_[i]);
+		if (blendMode_ != -1 && bm_ != blendMode_)
+			break;
+
+		blendMode_ = bm_;
+	}
+
+	return i;
+}
+
+bool Renderer::drawOpaque (std::span<Entity> children_, Entity camera_)
 {
+	if (currentFramebuffer || GetAlpha(camera_) < 1.)
+		return false;
+
+	childOpaque.assign(children_.size(), 0);
+
+	int opaqueCount_ = 0;
+	int runs_ = 0;
+
+	for (size_t i = 0; i < children_.size(); i++) {
+		auto [renderable_, masked_] = g_registry.try_get<
+			Components::Renderable, Components::Masked>(children_[i]);
+
+		// These are composited with a quad ignoring the depth
+		if (renderable_ && !renderable_->postPipelines.empty())
+			return false;
+
+		if (masked_ && masked_->mask != entt::null
+				&& !IsMaskStencil(masked_->mask))
+			return false;
+
+		childOpaque[i] = isOpaque(children_[i]);
+		opaqueCount_ += childOpaque[i];
+
+		if (i == 0 || childOpaque[i] != childOpaque[i - 1])
+			runs_++;
+	}
+
+	if (!opaqueCount_)
+		return false;
+
+	// Each run gets a depth in ]-1, 1[, the first one being the furthest
+	childDepths.resize(children_.size());
+
+	int run_ = -1;
+	for (size_t i = 0; i < children_.size(); i++) {
+		if (i == 0 || childOpaque[i] != childOpaque[i - 1])
+			run_++;
+
+		childDepths[i] = 1.f - 2.f * (run_ + 1) / (runs_ + 1);
+	}
+
 	flush();
 
-	// Update screen
-	SDL_GL_SwapWindow(g_window.window);
+	// The scissor of the camera limits the clear to its viewport
+	state.depthMask(true);
+	clear(GL_DEPTH_BUFFER_BIT);
+	state.depthFunc(GL_LESS);
+	state.enable(GL_DEPTH_TEST);
 
-	emit("post-render");
+	setBlendMode(BLEND_MODE::BLEND);
+
+	for (size_t i = children_.size(); i-- > 0;) {
+		if (!childOpaque[i])
+			continue;
+
+		setDepth(childDepths[i]);
+
+		Render(children_[i], camera_);
+	}
+
+	flush();
 
+	// The translucent Game Objects are tested against the opaque ones, but
+	// don't hide each other
+	state.depthMask(false);
+
+	return true;
+}
+
+bool Renderer::isOpaque (Entity gameObject_)
+{
+	auto [opaque_, renderable_, masked_] = g_registry.try_get<
+		Components::Opaque, Components::Renderable, Components::Masked>(
+				gameObject_);
+
+	if (!opaque_ || !renderable_
+			|| renderable_->pipeline != pipelines.MULTI_PIPELINE
+			|| !renderable_->postPipelines.empty()
+			|| (masked_ && masked_->mask != entt::null))
+		return false;
+
+	int bm_ = GetBlendMode(gameObject_);
+	if (bm_ != static_cast<int>(BLEND_MODE::NORMAL)
+			&& bm_ != static_cast<int>(BLEND_MODE::BLEND))
+		return false;
+
+	double tl_, tr_, bl_, br_;
+	GetAlpha(gameObject_, &tl_, &tr_, &bl_, &br_);
+
+	return GetAlpha(gameObject_) == 1. && tl_ == 1. && tr_ == 1. && bl_ == 1.
+		&& br_ == 1.;
+}
+
+void Renderer::setDepth (float depth_)
+{
+	if (depth_ == depth)
+		return;
+
+	flush();
+
+	depth = depth_;
+
+	// The other pipelines update their projection when bound
+	Pipeline *pipeline_ = pipelines.current;
+	if (pipeline_) {
+		pipeline_->updateProjectionMatrix();
+		setProgram(pipeline_->currentShader->program);
+	}
+}
+
+void Renderer::postRender ()
+{
+	flush();
+
+	// Start reading the snapshot back before the buffers are swapped
 	if (snapshotState.active) {
-		takeSnapshot();
+		state.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+		if (snapshotState.getPixel)
+			snapshots.readPixel(snapshotState.x, snapshotState.y,
+					snapshotState.callbackPixel);
+		else
+			snapshots.read(snapshotState.x, snapshotState.y,
+					snapshotState.width, snapshotState.height,
+					snapshotState.path, snapshotState.callback);
+
 		snapshotState.active = false;
 		snapshotState.callback = nullptr;
+		snapshotState.callbackPixel = nullptr;
 	}
 
+	recorder.capture();
+
+	gpuTimer.endFrame();
+
+	// Update screen
+	if (recordCommands)
+		commands.recordPresent();
+	else
+		SDL_GL_SwapWindow(g_window.window);
+
+	stats.textureBinds = state.frameTextureBinds;
+	stats.programSwitches = state.frameProgramSwitches;
+	stats.framebufferSwitches = state.frameFramebufferSwitches;
+	lastStats = stats;
+
+	const RenderStats *stats_ = &lastStats;
+	emit(Events::RENDER_STATS, stats_);
+
+	emit("post-render");
+
 	if (textureFlush > 0) {
 		startActiveTexture++;
 		currentActiveTexture = 1;
@@ -2081,6 +2516,16 @@ void Renderer::snapshotPixel (int x_, int y_, std::function<void(Color)>&& callb
 	return snapshotPixel(x_, y_, callback_);
 }
 
+bool Renderer::startRecording (std::string path_, int fps_)
+{
+	return recorder.start(path_, fps_, g_window.width(), g_window.height());
+}
+
+void Renderer::stopRecording ()
+{
+	recorder.stop();
+}
+
 void Renderer::snapshotFramebuffer (GL_fbo framebuffer, int bufferWidth,
 		int bufferHeight, std::function<void(SDL_Surface*)>&& callback,
 		bool getPixel, int x, int y, int width, int height, std::string path)
@@ -2186,43 +2631,7 @@ void Renderer::takeSnapshot ()
 
 void Renderer::saveSnapshot ()
 {
-	std::string& path_ = snapshotState.path;
-	std::string extension_ = "";
-
-	// Figure out the file type
-	for (auto c_ = path_.rbegin(); c_ != path_.rend(); c_++) {
-		if (*c_ == '.') {
-			// We read all the extension's characters
-			break;
-		}
-
-		extension_.insert(0, 1, *c_);
-	}
-
-	if (extension_ == "bmp") {
-		if (SDL_SaveBMP(snapshotState.surface, path_.c_str()))
-			MessageError("Failed to save snapshot as a 'BMP' file: ",
-					SDL_GetError());
-	}
-	else if (extension_ == "png") {
-		if (IMG_SavePNG(snapshotState.surface, path_.c_str()))
-			MessageError("Failed to save snapshot as a 'PNG' file: ",
-					IMG_GetError());
-	}
-	else if (extension_ == "jpg") {
-		if (IMG_SaveJPG(snapshotState.surface, path_.c_str(), 100))
-			MessageError("Failed to save snapshot as a 'JPG' file: ",
-					IMG_GetError());
-	}
-	else if (extension_ == "jpeg") {
-		if (IMG_SaveJPG(snapshotState.surface, path_.c_str(), 100))
-			MessageError("Failed to save snapshot as a 'JPEG' file: ",
-					IMG_GetError());
-	}
-	else {
-		MessageError("File type unsupported! Try something else like 'png' "
-				"or 'jpg'.");
-	}
+	SaveSurface(snapshotState.surface, snapshotState.path);
 }
 
 }	// namespace Zen
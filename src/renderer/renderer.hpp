@@ -11,7 +11,9 @@
 #include <SDL2/SDL.h>
 #include <functional>
 #include <map>
+#include <span>
 #include <vector>
+#include <cstdint>
 #include <cmath>
 #include <algorithm>
 #include <memory>
@@ -35,6 +37,17 @@
 
 #include "render_target.hpp"
 #include "pipeline_manager.hpp"
+#include "state_cache.hpp"
+#include "render_queue.hpp"
+#include "texture_arrays.hpp"
+#include "gpu_timer.hpp"
+#include "snapshot_reader.hpp"
+#include "program_cache.hpp"
+#include "frame_recorder.hpp"
+#include "render_stats.hpp"
+#include "command_log.hpp"
+#include "../enums/flush_reason.hpp"
+#include "../utils/thread/worker_pool.hpp"
 
 namespace Zen {
 
@@ -144,6 +157,15 @@ public:
      */
     void boot (RenderConfig config);
 
+	/**
+	 * Finishes the snapshots in flight, stops the frame recording and deletes
+	 * the OpenGL objects owned by the Renderer. Called by the Game while the OpenGL context is still
+	 * alive.
+	 *
+	 * @since 0.0.0
+	 */
+	void destroy ();
+
     /**
      * The event handler that manages the `resize` event dispatched by the Scale
 	 * Manager.
@@ -184,6 +206,29 @@ public:
      */
     RenderTarget* endCapture ();
 
+	/**
+	 * Redirects the drawing to the framebuffer of a Render Texture, until
+	 * `popRenderTexture` is called.
+	 *
+	 * The content is drawn 1:1 in pixels, without scissor, and right side up
+	 * in the texture so the Render Texture can be drawn like any image.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param framebuffer The framebuffer of the Render Texture.
+	 * @param width The width of the Render Texture.
+	 * @param height The height of the Render Texture.
+	 */
+	void pushRenderTexture (GL_fbo framebuffer, int width, int height);
+
+	/**
+	 * Stops drawing to the last Render Texture pushed, and goes back to the
+	 * previous one or the game.
+	 *
+	 * @since 0.0.0
+	 */
+	void popRenderTexture ();
+
     /**
      * Resizes the drawing buffer to match that required by the Scale Manager.
      *
@@ -227,8 +272,10 @@ public:
      * Flushes the current pipeline if the pipeline is bound
      *
      * @since 0.0.0
+	 *
+	 * @param reason Why the batch is flushed, counted in the stats.
      */
-	void flush ();
+	void flush (FLUSH_REASON reason = FLUSH_REASON::OTHER);
 
     /**
      * Pushes a new scissor state. This is used to set nested scissor states.
@@ -593,6 +640,81 @@ public:
 			GLenum wrapT, GLenum wrapS, GLenum format, SDL_Surface* surface,
 			int width = 1, int height = 1, bool forceSize = false);
 
+	/**
+	 * Uploads the pixels of a surface into a region of an existing
+	 * GL_texture.
+	 *
+	 * The surface must be in the `SDL_PIXELFORMAT_RGBA32` format.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture The texture to update.
+	 * @param x The x position of the region in the texture.
+	 * @param y The y position of the region in the texture.
+	 * @param surface The pixels to upload.
+	 */
+	void updateTexture2D (GL_texture texture, int x, int y,
+			SDL_Surface* surface);
+
+	/**
+	 * Gets the GPU timings of the latest frame whose results are available,
+	 * which is usually a few frames behind. The `gpuTimers` option must be
+	 * set.
+	 *
+	 * The `Events::RENDER_GPU_TIMINGS` event is also emitted with each new
+	 * report.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The timings report.
+	 */
+	const GpuTimingReport& getGpuTimings () const;
+
+	/**
+	 * Gets the stats of the last rendered frame: the draw calls and vertices
+	 * of each pipeline, the reasons of the flushes and the state changes.
+	 *
+	 * The `Events::RENDER_STATS` event is also emitted at the end of every
+	 * frame, right before `post-render`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The stats.
+	 */
+	const RenderStats& getStats () const;
+
+	/**
+	 * Gets the commands recorded during the last frame, with the
+	 * `RENDER_BACKEND::RECORD` backend. The log is empty otherwise.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The log.
+	 */
+	const CommandLog& getCommandLog () const;
+
+	/**
+	 * Clears the given buffers of the bound framebuffer, or records it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param mask The buffers to clear.
+	 */
+	void clear (GLbitfield mask);
+
+	/**
+	 * Draws vertices from the bound vertex array, or records it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param name The name of the pipeline drawing.
+	 * @param topology The primitive to draw.
+	 * @param first The first vertex.
+	 * @param count The number of vertices.
+	 */
+	void drawArrays (const std::string& name, GLenum topology, GLint first,
+			GLsizei count);
+
     /**
      * Creates a OpenGL Framebuffer object and optionally binds a depth stencil
 	 * render buffer.
@@ -673,6 +795,23 @@ public:
 	GL_ibo createIndexBuffer (std::vector<std::uint8_t> initialData,
 			GLenum bufferUsage);
 
+    /**
+     * Returns the shared, static index buffer used by the pipelines that batch
+     * indexed quads.
+     *
+     * Every quad uses the indices `0, 1, 2, 0, 2, 3` offset by its first
+     * vertex. The buffer is created on the first call and grown in place if a
+     * later pipeline needs more quads, so vertex arrays already referencing it
+     * stay valid.
+     *
+     * @since 0.0.0
+     *
+     * @param quads The minimum number of quads the buffer must hold.
+     *
+     * @return The quad index buffer.
+     */
+	GL_ibo getQuadIndexBuffer (int quads);
+
     /**
      * Calls `glDeleteTexture` on the given GL_texture and also optionally
      * resets the currently defined textures.
@@ -769,7 +908,70 @@ public:
 	 * the given Camera.
      * @param camera The Scene Camera to render with.
      */
-	void render (std::vector<Entity> children, Entity camera);
+	void render (std::span<Entity> children, Entity camera);
+
+    /**
+     * Finds the end of a run of Sprites that can be batched in parallel by
+	 * `MultiPipeline::batchSprites`.
+     *
+     * The Game Objects of a run are images using the Multi Pipeline with the
+	 * same blend mode, without mask or Post FX pipelines.
+     *
+     * @since 0.0.0
+     *
+     * @param children The Game Objects being rendered.
+     * @param first The index of the first Game Object of the run.
+	 *
+     * @return The index following the last Game Object of the run.
+     */
+	size_t getSpriteRunEnd (std::span<const Entity> children, size_t first);
+
+	/**
+	 * Draws the opaque Game Objects of a camera front to back, with depth
+	 * writes, and gives every Game Object its depth for the translucent pass.
+	 *
+	 * Each run of consecutive opaque, or translucent, Game Objects in the
+	 * display list gets its own depth, decreasing towards the top of the list.
+	 * Within an opaque run, drawing front to back with `GL_LESS` already keeps
+	 * the topmost pixels, so sharing a depth costs no flush.
+	 *
+	 * The pass is skipped if the camera renders to a framebuffer, isn't fully
+	 * opaque, has no opaque Game Object, or has Game Objects composited with a
+	 * Post FX pipeline or a bitmap mask, as these draws ignore the depth.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param children The Game Objects being rendered.
+	 * @param camera The Scene Camera to render with.
+	 *
+	 * @return `true` if the opaque pass was drawn, in which case the other Game
+	 * Objects must be drawn with `setDepth` and the depth test.
+	 */
+	bool drawOpaque (std::span<Entity> children, Entity camera);
+
+	/**
+	 * Can the given Game Object be drawn in the opaque pass?
+	 *
+	 * It must be set as opaque, fully visible, use the default blend mode and
+	 * the Multi Pipeline, and have no mask or Post FX pipeline.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param gameObject The Game Object.
+	 *
+	 * @return `true` if the Game Object can be drawn as opaque.
+	 */
+	bool isOpaque (Entity gameObject);
+
+	/**
+	 * Sets the depth at which the next vertices are drawn, flushing the batch
+	 * if it changes.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param depth The depth, in normalized device coordinates.
+	 */
+	void setDepth (float depth);
 
     /**
      * The post-render step happens after all Cameras in all Scenes have been
@@ -789,6 +991,10 @@ public:
 	 * Only one snapshot can be active _per frame_. If you have already called
 	 * snapshotPixel, for example, then calling this method will override it.
 	 *
+	 * The pixels are read back without stalling the frame, so the callback is
+	 * invoked a frame or two later, once the image file, if any, is saved. The
+	 * surface given to it is freed when the next snapshot completes.
+	 *
 	 * @since 0.0.0
 	 *
 	 * @param callback The function to invoke once the snapshot is created.
@@ -808,6 +1014,8 @@ public:
 	 * Only one snapshot can be active _per frame_. If you have already called
 	 * snapshotPixel, for example, then calling this method will override it.
 	 *
+	 * Like `snapshot`, the callback is invoked a frame or two later.
+	 *
 	 * @since 0.0.0
 	 *
 	 * @param x The x coordinate to grab from.
@@ -834,7 +1042,8 @@ public:
 	 * calling this method will override it.
 	 *
 	 * Unlike the other two snapshot methods, this one will return a Color
-	 * object containing the color data for the requested pixel.
+	 * object containing the color data for the requested pixel. It is also
+	 * read back asynchronously.
 	 *
 	 * @since 0.0.0
 	 *
@@ -854,6 +1063,34 @@ public:
 	 */
 	void snapshotPixel (int x, int y, std::function<void(Color)>&& callback);
 	
+	/**
+	 * Starts recording the window into a video stream, until `stopRecording`
+	 * is called.
+	 *
+	 * A path ending in `.y4m` gets a YUV4MPEG2 stream, any other path the raw
+	 * RGBA frames. A path starting with `|` is run as a command receiving the
+	 * stream, e.g. `"| ffmpeg -i - out.mp4"`.
+	 *
+	 * The frames are read back and written without ever blocking the game
+	 * loop. The frames that can't keep up are dropped, and counted in
+	 * `recorder.dropped`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param path The path of the file, or `|` followed by a command.
+	 * @param fps The number of frames to record per second.
+	 *
+	 * @return `true` if the recording started.
+	 */
+	bool startRecording (std::string path, int fps = 60);
+
+	/**
+	 * Stops recording, once the frames in flight are written.
+	 *
+	 * @since 0.0.0
+	 */
+	void stopRecording ();
+
 	/**
 	 * Takes a snapshot of the given area of the given framebuffer.
 	 *
@@ -930,6 +1167,103 @@ public:
 	 */
 	RenderConfig config;
 
+	/**
+	 * The shadow of the OpenGL state, through which all the renderer code
+	 * changes it.
+	 *
+	 * Its `lastFrameSavedCalls` property holds the number of redundant state
+	 * calls it dropped during the last frame.
+	 *
+	 * @since 0.0.0
+	 */
+	StateCache state;
+
+	/**
+	 * The queue reordering the display lists to merge batches, when the
+	 * `batchReorder` option is set.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderQueue renderQueue;
+
+	/**
+	 * The threads generating the vertices of the runs of Sprites, started
+	 * when the `batchThreads` option is set. Without them, the runs are
+	 * generated on the main thread.
+	 *
+	 * @since 0.0.0
+	 */
+	WorkerPool workers;
+
+	/**
+	 * The texture arrays packing the Texture Sources of the same size, used
+	 * when the `textureArrays` option is set.
+	 *
+	 * @since 0.0.0
+	 */
+	TextureArrays textureArrays;
+
+	/**
+	 * Measures the GPU time of the flushes, cameras and post pipelines, when
+	 * the `gpuTimers` option is set. See `getGpuTimings`.
+	 *
+	 * @since 0.0.0
+	 */
+	GpuTimer gpuTimer;
+
+	/**
+	 * Reads the scheduled snapshots back asynchronously, and saves their image
+	 * files on a background thread.
+	 *
+	 * @since 0.0.0
+	 */
+	SnapshotReader snapshots;
+
+	/**
+	 * Stores the linked shader programs on disk, when the
+	 * `programCacheDirectory` option is set.
+	 *
+	 * @since 0.0.0
+	 */
+	ProgramCache programCache;
+
+	/**
+	 * Streams the rendered frames while recording. See `startRecording`.
+	 *
+	 * @since 0.0.0
+	 */
+	FrameRecorder recorder;
+
+	/**
+	 * The stats of the frame being rendered. The pipelines and masks add to
+	 * them. See `getStats` for the stats of the last complete frame.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderStats stats;
+
+	/**
+	 * The stats of the last rendered frame.
+	 *
+	 * @since 0.0.0
+	 */
+	RenderStats lastStats;
+
+	/**
+	 * The commands of the last frame, with the `RENDER_BACKEND::RECORD`
+	 * backend. See `getCommandLog`.
+	 *
+	 * @since 0.0.0
+	 */
+	CommandLog commands;
+
+	/**
+	 * Is the rendering recorded rather than drawn? See `RENDER_BACKEND`.
+	 *
+	 * @since 0.0.0
+	 */
+	bool recordCommands = false;
+
 	/**
 	 * An instance of the Pipeline Manager class, that handles all Pipelines.
 	 *
@@ -999,6 +1333,21 @@ public:
 	 */
 	int maxTextures = 16;
 
+	/**
+	 * The static index buffer shared by all the pipelines batching indexed
+	 * quads.
+	 *
+	 * @since 0.0.0
+	 */
+	GL_ibo quadIndexBuffer = 0;
+
+	/**
+	 * The number of quads the `quadIndexBuffer` can currently index.
+	 *
+	 * @since 0.0.0
+	 */
+	int quadIndexCapacity = 0;
+
 	/**
 	 * An array of the available OpenGL texture units, used to populate the
 	 * uSampler uniforms.
@@ -1034,6 +1383,37 @@ public:
 	 */
 	GL_texture normalTexture;
 
+	/**
+	 * The depth at which the vertices are drawn, in normalized device
+	 * coordinates. It is only changed during the opaque pass.
+	 *
+	 * @since 0.0.0
+	 */
+	float depth = 0.f;
+
+	/**
+	 * Is the camera being rendered using the opaque pass?
+	 *
+	 * @since 0.0.0
+	 */
+	bool opaquePass = false;
+
+	/**
+	 * Which Game Objects of the camera being rendered are drawn in the opaque
+	 * pass.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::uint8_t> childOpaque;
+
+	/**
+	 * The depth of each Game Object of the camera being rendered, when the
+	 * opaque pass is used.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<float> childDepths;
+
 	/**
 	 * The currently bound framebuffer in use.
 	 *
@@ -1048,6 +1428,16 @@ public:
 	 */
 	std::vector<GL_fbo> fboStack;
 
+	/**
+	 * The sizes of the Render Textures being drawn to, pushed and popped with
+	 * `pushRenderTexture` and `popRenderTexture`.
+	 *
+	 * The pipelines project onto the last one instead of the game size.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::array<int, 2>> renderTextureStack;
+
 	/**
 	 * Current Program in use.
 	 *
@@ -1136,12 +1526,12 @@ public:
 	Mask_ currentCameraMask;
 
 	/**
-	 * The `type` of the Game Object being currently rendered.
+	 * The interned `type` id of the Game Object being currently rendered.
 	 * This can be used by advanced render functions for batching look-ahead.
 	 *
 	 * @since 0.0.0
 	 */
-	std::string currentType;
+	int currentType = 0;
 
 	/**
 	 * Is the `type` of the Game Object being currently rendered different than the
@@ -27,6 +27,15 @@ Shader::Shader (std::string name, std::string vertexShader,
 
 void Shader::createProgram (std::string vertexShader, std::string fragmentShader)
 {
+	// Skip the compilation if the driver still accepts the cached binary
+	program = g_renderer.programCache.load(vertexShader, fragmentShader);
+
+	if (program) {
+		g_renderer.state.useProgram(program);
+
+		return;
+	}
+
 	const char *vsCode = vertexShader.c_str();
 	const char *fsCode = fragmentShader.c_str();
 
@@ -44,15 +53,22 @@ void Shader::createProgram (std::string vertexShader, std::string fragmentShader
 	program = glCreateProgram();
 	glAttachShader(program, vs);
 	glAttachShader(program, fs);
+
+	if (g_renderer.programCache.enabled)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+				GL_TRUE);
+
 	glLinkProgram(program);
 	checkCompileErrors(program, "PROGRAM");
 
+	g_renderer.programCache.save(program, vertexShader, fragmentShader);
+
 	// Delete the shaders as they're linked into our program now and no
 	// longer necessery
 	glDeleteShader(vs);
 	glDeleteShader(fs);
 
-	glUseProgram(program);
+	g_renderer.state.useProgram(program);
 }
 
 void Shader::checkCompileErrors (GLuint shader, std::string type)
@@ -105,7 +121,8 @@ void Shader::createAttributes (
 			offset,
 			normalized,
 			false,
-			-1
+			-1,
+			element.divisor
 		);
 
 		if (typeSize == 4)
@@ -155,6 +172,7 @@ void Shader::setAttribPointers (bool reset)
 		glVertexAttribPointer(attribLocation, element.size, element.type,
 				element.normalized, vertexSize,
 				reinterpret_cast<void*>(element.offset));
+		glVertexAttribDivisor(attribLocation, element.divisor);
 
 		element.enabled = true;
 		element.location = attribLocation;
@@ -227,6 +245,69 @@ void Shader::createUniforms ()
 			}
 		}
 	}
+
+	// Index the uniforms by handle, the map nodes are never reallocated
+	uniformHandles.clear();
+
+	for (auto &[name_, uniform_] : uniforms) {
+		UniformHandle handle_ = GetUniformHandle(name_);
+
+		if (handle_.id >= static_cast<int>(uniformHandles.size()))
+			uniformHandles.resize(handle_.id + 1, nullptr);
+
+		uniformHandles[handle_.id] = &uniform_;
+	}
+}
+
+PipelineUniformConfig* Shader::findUniform (const std::string &name,
+		int *index)
+{
+	std::string uniformName = name;
+
+	std::size_t found = uniformName.find("[");
+	*index = -1;
+
+	// Is the passed name indexed? e.g. uName[3], uTexture[7]
+	if (found != std::string::npos) {
+		*index = std::stoi(name.substr(found+1));
+		uniformName = name.substr(0, found);
+
+		if (*index < 0) {
+			MessageWarning("Cannot set uniform \"", name, "\" :: Index cannot "
+					"be negative");
+			return nullptr;
+		}
+	}
+
+	// Does the uniform exist?
+	auto it = uniforms.find(uniformName);
+
+	if (it == uniforms.end()) {
+		MessageWarning("Cannot set uniform \"", name, "\" :: Uniform does "
+				"not exist");
+		return nullptr;
+	}
+
+	// Get the uniform
+	auto &uniform = it->second;
+
+	// If the given name is indexed, is the uniform an array?
+	if (*index > -1 && uniform.length == 1) {
+		// If not, then the passed in name is wrong and shouldn't be indexed
+		MessageWarning("Cannot set uniform \"", name, "\" :: The uniform is "
+				"not an array");
+		return nullptr;
+	}
+	else if (*index == -1) {
+		*index = 0;
+	}
+	else if (*index >= uniform.length) {
+		MessageWarning("Cannot set uniform \"", name, "\" :: Out of bounds "
+				"index");
+		return nullptr;
+	}
+
+	return &uniform;
 }
 
 bool Shader::hasUniform (std::string name)
@@ -244,4 +325,10 @@ void Shader::resetUniform (std::string name)
 	uniform.value.clear();
 }
 
+void Shader::resetUniform (UniformHandle handle)
+{
+	if (auto *uniform = getUniform(handle))
+		uniform->value.clear();
+}
+
 }	// namespace Zen
@@ -9,6 +9,7 @@
 #define ZEN_RENDERER_GL_SHADER_HPP
 
 #include <vector>
+#include <array>
 #include <map>
 #include <cstring>
 #include <glm/glm.hpp>
@@ -16,6 +17,7 @@
 #include "types/gl_pipeline_attribute.hpp"
 #include "types/gl_pipeline_attribute_config.hpp"
 #include "types/gl_pipeline_uniforms_config.hpp"
+#include "types/gl_uniform_handle.hpp"
 #include "types/gl_types.hpp"
 #include "../event/event_emitter.hpp"
 #include "utility.hpp"
@@ -143,6 +145,14 @@ public:
      */
 	void resetUniform (std::string name);
 
+    /**
+     * @overload
+     * @since 0.0.0
+     *
+     * @param handle The handle of the uniform to reset.
+     */
+	void resetUniform (UniformHandle handle);
+
 	/**
 	 * Sets a uniform of the given name on this shader of type: mat2, mat3, mat4.
 	 *
@@ -165,38 +175,20 @@ public:
 	void set (const std::string &name, bool transpose, const glm::mat<N, N, T>& mat)
 	{
 		const T *ptr = glm::value_ptr(mat);
-		auto *uniform = prepareUniform(name, N*N, ptr);
-
-		if (!uniform)
-			return;
+		upload(prepareUniform(name, N*N, ptr), transpose, mat);
+	}
 
-		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
-			if		constexpr	(N == 2)
-				glUniformMatrix2fv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 3)
-				glUniformMatrix3fv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 4)
-				glUniformMatrix4fv(uniform->location, 1, transpose, ptr);
-		}
-		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
-			if		constexpr	(N == 2)
-				glUniformMatrix2iv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 3)
-				glUniformMatrix3iv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 4)
-				glUniformMatrix4iv(uniform->location, 1, transpose, ptr);
-		}
-		else if constexpr (std::is_same_v<T, unsigned int>) {
-			if		constexpr	(N == 2)
-				glUniformMatrix2uiv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 3)
-				glUniformMatrix3uiv(uniform->location, 1, transpose, ptr);
-			else if constexpr	(N == 4)
-				glUniformMatrix4uiv(uniform->location, 1, transpose, ptr);
-		}
-		else {
-			MessageWarning("Unsupported uniform type!");
-		}
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * Sets a matrix uniform from its handle, skipping the name lookup.
+	 */
+	template <typename T, int N>
+	void set (UniformHandle handle, bool transpose, const glm::mat<N, N, T>& mat)
+	{
+		const T *ptr = glm::value_ptr(mat);
+		upload(prepareUniform(handle, N*N, ptr), transpose, mat);
 	}
 
 	/**
@@ -230,58 +222,23 @@ public:
 	>
 	void set (const std::string &name, T value, Args ... args)
 	{
-		constexpr std::size_t N = sizeof...(Args) + 1;
-
-		PipelineUniformConfig *uniform;
-		if constexpr (std::is_same_v<T, double>) {		// If double, make it float
-			std::vector<float> vec {value, args...};
-			uniform = prepareUniform(name, N, vec.data());
-		}
-		else if constexpr (std::is_same_v<T, bool>) {	// If bool, make it int
-			std::vector<int> vec {value, args...};
-			uniform = prepareUniform(name, N, vec.data());
-		}
-		else {
-			std::vector<T> vec {value, args...};
-			uniform = prepareUniform(name, N, vec.data());
-		}
-
-		if (!uniform)
-			return;
+		upload(prepareValues(name, value, args...), value, args...);
+	}
 
-		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
-			if		constexpr (N == 1)
-				glUniform1f(uniform->location, value);
-			else if	constexpr (N == 2)
-				glUniform2f(uniform->location, value, args...);
-			else if	constexpr (N == 3)
-				glUniform3f(uniform->location, value, args...);
-			else if	constexpr (N == 4)
-				glUniform4f(uniform->location, value, args...);
-		}
-		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
-			if		constexpr (N == 1)
-				glUniform1i(uniform->location, value);
-			else if	constexpr (N == 2)
-				glUniform2i(uniform->location, value, args...);
-			else if	constexpr (N == 3)
-				glUniform3i(uniform->location, value, args...);
-			else if	constexpr (N == 4)
-				glUniform4i(uniform->location, value, args...);
-		}
-		else if constexpr (std::is_same_v<T, unsigned int>) {
-			if		constexpr (N == 1)
-				glUniform1ui(uniform->location, value);
-			else if	constexpr (N == 2)
-				glUniform2ui(uniform->location, value, args...);
-			else if	constexpr (N == 3)
-				glUniform3ui(uniform->location, value, args...);
-			else if	constexpr (N == 4)
-				glUniform4ui(uniform->location, value, args...);
-		}
-		else {
-			MessageWarning("Unsupported uniform type!");
-		}
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * Sets a uniform of type T from its handle, skipping the name lookup.
+	 */
+	template <
+		typename T,
+		typename ... Args,
+		typename = std::enable_if_t<(std::is_same_v<T, Args> && ...)>
+	>
+	void set (UniformHandle handle, T value, Args ... args)
+	{
+		upload(prepareValues(handle, value, args...), value, args...);
 	}
 
 	/**
@@ -310,30 +267,19 @@ public:
 	template <typename T, int N>
 	void set (const std::string &name, const glm::vec<N, T>& vec)
 	{
-		const T *ptr = glm::value_ptr(vec);
-		auto *uniform = prepareUniform(name, N, ptr);
-
-		if (!uniform)
-			return;
+		upload(prepareUniform(name, N, glm::value_ptr(vec)), vec);
+	}
 
-		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
-			if		constexpr (N == 2) glUniform2fv(uniform->location, 1, ptr);
-			else if	constexpr (N == 3) glUniform3fv(uniform->location, 1, ptr);
-			else if	constexpr (N == 4) glUniform4fv(uniform->location, 1, ptr);
-		}
-		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
-			if		constexpr (N == 2) glUniform2iv(uniform->location, 1, ptr);
-			else if	constexpr (N == 3) glUniform3iv(uniform->location, 1, ptr);
-			else if	constexpr (N == 4) glUniform4iv(uniform->location, 1, ptr);
-		}
-		else if constexpr (std::is_same_v<T, unsigned int>) {
-			if		constexpr (N == 2) glUniform2uiv(uniform->location, 1, ptr);
-			else if	constexpr (N == 3) glUniform3uiv(uniform->location, 1, ptr);
-			else if	constexpr (N == 4) glUniform4uiv(uniform->location, 1, ptr);
-		}
-		else {
-			MessageWarning("Unsupported uniform type!");
-		}
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * Sets a vecN uniform from its handle, skipping the name lookup.
+	 */
+	template <typename T, int N>
+	void set (UniformHandle handle, const glm::vec<N, T>& vec)
+	{
+		upload(prepareUniform(handle, N, glm::value_ptr(vec)), vec);
 	}
 
 	/**
@@ -360,19 +306,21 @@ public:
 	template <typename T>
 	void set (const std::string &name, const std::vector<T>& data)
 	{
-		auto *uniform = prepareUniform(name, data.size(), data.data());
-
-		if (!uniform)
-			return;
+		upload(prepareUniform(name, data.size(), data.data()), data.size(),
+				data.data());
+	}
 
-		if constexpr (std::is_same_v<T, float>)
-			glUniform1fv(uniform->location, data.size(), data.data());
-		else if constexpr (std::is_same_v<T, int>)
-			glUniform1iv(uniform->location, data.size(), data.data());
-		else if constexpr (std::is_same_v<T, unsigned int>)
-			glUniform1uiv(uniform->location, data.size(), data.data());
-		else
-			MessageWarning("Unsupported uniform type!");
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * Sets an array uniform from its handle, skipping the name lookup.
+	 */
+	template <typename T>
+	void set (UniformHandle handle, const std::vector<T>& data)
+	{
+		upload(prepareUniform(handle, data.size(), data.data()), data.size(),
+				data.data());
 	}
 
 	/**
@@ -400,24 +348,46 @@ public:
 	template <typename T, int N>
 	void set (const std::string &name, const std::array<T, N>& data)
 	{
-		auto *uniform = prepareUniform(name, N, data.data());
-
-		if (uniform) {
-			if constexpr (std::is_same_v<T, float>)
-				glUniform1fv(uniform->location, N, data.data());
-			else if constexpr (std::is_same_v<T, int>)
-				glUniform1iv(uniform->location, N, data.data());
-			else if constexpr (std::is_same_v<T, unsigned int>)
-				glUniform1uiv(uniform->location, N, data.data());
-			else
-				MessageWarning("Unsupported uniform type!");
-		}
+		upload(prepareUniform(name, N, data.data()), N, data.data());
+	}
+
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * Sets an array uniform from its handle, skipping the name lookup.
+	 */
+	template <typename T, int N>
+	void set (UniformHandle handle, const std::array<T, N>& data)
+	{
+		upload(prepareUniform(handle, N, data.data()), N, data.data());
+	}
+
+	/**
+	 * Gets the uniform of this shader matching the given handle.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param handle The handle of the uniform, from `GetUniformHandle`.
+	 *
+	 * @return A pointer to the uniform, or `nullptr` if this shader doesn't
+	 * have it.
+	 */
+	PipelineUniformConfig* getUniform (UniformHandle handle)
+	{
+		if (handle.id < 0 || handle.id >= static_cast<int>(uniformHandles.size()))
+			return nullptr;
+
+		return uniformHandles[handle.id];
 	}
 
 	/**
 	 * Find uniform and verifies if the data we're about to set it to is different,
 	 * otherwise, updating it is useless.
 	 *
+	 * This is the slow path, parsing the name and looking it up in the
+	 * uniforms map.
+	 *
 	 * @since 0.0.0
 	 *
 	 * @tparam T The type of the data and thus of the uniform itself.
@@ -429,66 +399,102 @@ public:
 	PipelineUniformConfig* prepareUniform (const std::string &name, size_t size,
 			const T* data)
 	{
-		std::string uniformName = name;
+		int index = 0;
+		auto *uniform = findUniform(name, &index);
 
-		std::size_t found = uniformName.find("[");
-		int index = -1;
+		if (!uniform)
+			return nullptr;
 
-		// Is the passed name indexed? e.g. uName[3], uTexture[7]
-		if (found != std::string::npos) {
-			index = std::stoi(name.substr(found+1));
-			uniformName = name.substr(0, found);
+		return updateUniform(uniform, index, size, data);
+	}
 
-			if (index < 0) {
-				MessageWarning("Cannot set uniform \"", name, "\" :: Index cannot "
-						"be negative");
-				return nullptr;
-			}
-		}
+	/**
+	 * @overload
+	 * @since 0.0.0
+	 *
+	 * @tparam T The type of the data and thus of the uniform itself.
+	 * @param handle The handle of the uniform.
+	 * @param size The number of elements in the data array.
+	 * @param data A data array.
+	 */
+	template <typename T>
+	PipelineUniformConfig* prepareUniform (UniformHandle handle, size_t size,
+			const T* data)
+	{
+		auto *uniform = getUniform(handle);
 
-		// Does the uniform exist?
-		if (uniforms.find(uniformName) == uniforms.end()) {
-			MessageWarning("Cannot set uniform \"", name, "\" :: Uniform does "
-					"not exist");
+		// Not every shader has every uniform, this is not an error
+		if (!uniform)
 			return nullptr;
-		}
 
-		// Get the uniform
-		auto &uniform = uniforms[uniformName];
+		return updateUniform(uniform, 0, size, data);
+	}
 
-		// The size in bytes of a single element in the uniform if an array,
-		// otherwise the size of the whole uniform
-		size_t byteSize = sizeof(T) / sizeof(std::uint8_t);
+	/**
+	 * Packs the given values the way they are uploaded, doubles as floats and
+	 * bools as ints, before preparing the uniform.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key The name or handle of the uniform.
+	 * @param value The first value.
+	 * @param args The values in addition to the first.
+	 */
+	template <typename K, typename T, typename ... Args>
+	PipelineUniformConfig* prepareValues (const K& key, T value, Args ... args)
+	{
+		constexpr std::size_t N = sizeof...(Args) + 1;
 
-		if ((sizeof(T)*size) > uniform.size) {
-			MessageWarning("Cannot set uniform \"", name, "\" :: The size of "
-					"the data (", (sizeof(T)*size), " bytes) is greater than "
-					"the size of the uniform (", uniform.size, " bytes)");
-			return nullptr;
+		if constexpr (std::is_same_v<T, double>) {		// If double, make it float
+			std::array<float, N> vec {static_cast<float>(value),
+				static_cast<float>(args)...};
+			return prepareUniform(key, N, vec.data());
 		}
-
-		// If the given name is indexed, is the uniform an array?
-		if (index > -1 && uniform.length == 1) {
-			// If not, then the passed in name is wrong and shouldn't be indexed
-			MessageWarning("Cannot set uniform \"", name, "\" :: The uniform is "
-					"not an array");
-			return nullptr;
+		else if constexpr (std::is_same_v<T, bool>) {	// If bool, make it int
+			std::array<int, N> vec {value, args...};
+			return prepareUniform(key, N, vec.data());
 		}
-		else if (index == -1) {
-			index = 0;
+		else {
+			std::array<T, N> vec {value, args...};
+			return prepareUniform(key, N, vec.data());
 		}
-		else if (index >= uniform.length) {
-			MessageWarning("Cannot set uniform \"", name, "\" :: Out of bounds "
-					"index");
+	}
+
+	/**
+	 * Verifies if the data we're about to set the uniform to is different from
+	 * its cached value, and caches it if so.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @tparam T The type of the data and thus of the uniform itself.
+	 * @param uniform The uniform.
+	 * @param index The index of the first element to set, if an array.
+	 * @param size The number of elements in the data array.
+	 * @param data A data array.
+	 *
+	 * @return The uniform if it needs to be uploaded, otherwise `nullptr`.
+	 */
+	template <typename T>
+	PipelineUniformConfig* updateUniform (PipelineUniformConfig *uniform,
+			int index, size_t size, const T* data)
+	{
+		// The size in bytes of a single element in the uniform if an array,
+		// otherwise the size of the whole uniform
+		size_t byteSize = sizeof(T) / sizeof(std::uint8_t);
+
+		if ((sizeof(T)*size) > uniform->size) {
+			MessageWarning("Cannot set uniform \"", uniform->name, "\" :: The "
+					"size of the data (", (sizeof(T)*size), " bytes) is greater "
+					"than the size of the uniform (", uniform->size, " bytes)");
 			return nullptr;
 		}
 
 		T *value = reinterpret_cast<T*>(
 				// Offset pointer if uniform is an array
-				uniform.value.data() + byteSize * index
+				uniform->value.data() + byteSize * index
 		);
 
-		if (!uniform.value.empty()) {
+		if (!uniform->value.empty()) {
 			// Compare the data
 			int res = std::memcmp(data, value, byteSize * size);
 
@@ -497,9 +503,9 @@ public:
 				return nullptr;
 		}
 		else {
-			uniform.value.resize(uniform.size);
+			uniform->value.resize(uniform->size);
 			value = reinterpret_cast<T*>(
-					uniform.value.data() + byteSize * index
+					uniform->value.data() + byteSize * index
 			);
 		}
 
@@ -509,7 +515,170 @@ public:
 		emit("set-program", program);
 		emit("set-current", this);
 
-		return &uniform;
+		return uniform;
+	}
+
+	/**
+	 * Parses the given uniform name, which can be indexed like `uName[3]`, and
+	 * finds the uniform it refers to.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param name The name of the uniform.
+	 * @param index A pointer to store the parsed index in, 0 if not indexed.
+	 *
+	 * @return A pointer to the uniform, or `nullptr` if it doesn't exist.
+	 */
+	PipelineUniformConfig* findUniform (const std::string &name, int *index);
+
+	/**
+	 * Uploads a matrix to the given uniform, if any.
+	 *
+	 * @since 0.0.0
+	 */
+	template <typename T, int N>
+	void upload (PipelineUniformConfig *uniform, bool transpose,
+			const glm::mat<N, N, T>& mat)
+	{
+		if (!uniform)
+			return;
+
+		const T *ptr = glm::value_ptr(mat);
+
+
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+			if		constexpr	(N == 2)
+				glUniformMatrix2fv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 3)
+				glUniformMatrix3fv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 4)
+				glUniformMatrix4fv(uniform->location, 1, transpose, ptr);
+		}
+		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
+			if		constexpr	(N == 2)
+				glUniformMatrix2iv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 3)
+				glUniformMatrix3iv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 4)
+				glUniformMatrix4iv(uniform->location, 1, transpose, ptr);
+		}
+		else if constexpr (std::is_same_v<T, unsigned int>) {
+			if		constexpr	(N == 2)
+				glUniformMatrix2uiv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 3)
+				glUniformMatrix3uiv(uniform->location, 1, transpose, ptr);
+			else if constexpr	(N == 4)
+				glUniformMatrix4uiv(uniform->location, 1, transpose, ptr);
+		}
+		else {
+			MessageWarning("Unsupported uniform type!");
+		}
+	}
+
+	/**
+	 * Uploads one to four values to the given uniform, if any.
+	 *
+	 * @since 0.0.0
+	 */
+	template <
+		typename T,
+		typename ... Args,
+		typename = std::enable_if_t<(std::is_same_v<T, Args> && ...)>
+	>
+	void upload (PipelineUniformConfig *uniform, T value, Args ... args)
+	{
+		constexpr std::size_t N = sizeof...(Args) + 1;
+
+		if (!uniform)
+			return;
+
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+			if		constexpr (N == 1)
+				glUniform1f(uniform->location, value);
+			else if	constexpr (N == 2)
+				glUniform2f(uniform->location, value, args...);
+			else if	constexpr (N == 3)
+				glUniform3f(uniform->location, value, args...);
+			else if	constexpr (N == 4)
+				glUniform4f(uniform->location, value, args...);
+		}
+		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
+			if		constexpr (N == 1)
+				glUniform1i(uniform->location, value);
+			else if	constexpr (N == 2)
+				glUniform2i(uniform->location, value, args...);
+			else if	constexpr (N == 3)
+				glUniform3i(uniform->location, value, args...);
+			else if	constexpr (N == 4)
+				glUniform4i(uniform->location, value, args...);
+		}
+		else if constexpr (std::is_same_v<T, unsigned int>) {
+			if		constexpr (N == 1)
+				glUniform1ui(uniform->location, value);
+			else if	constexpr (N == 2)
+				glUniform2ui(uniform->location, value, args...);
+			else if	constexpr (N == 3)
+				glUniform3ui(uniform->location, value, args...);
+			else if	constexpr (N == 4)
+				glUniform4ui(uniform->location, value, args...);
+		}
+		else {
+			MessageWarning("Unsupported uniform type!");
+		}
+	}
+
+	/**
+	 * Uploads a vecN to the given uniform, if any.
+	 *
+	 * @since 0.0.0
+	 */
+	template <typename T, int N>
+	void upload (PipelineUniformConfig *uniform, const glm::vec<N, T>& vec)
+	{
+		if (!uniform)
+			return;
+
+		const T *ptr = glm::value_ptr(vec);
+
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+			if		constexpr (N == 2) glUniform2fv(uniform->location, 1, ptr);
+			else if	constexpr (N == 3) glUniform3fv(uniform->location, 1, ptr);
+			else if	constexpr (N == 4) glUniform4fv(uniform->location, 1, ptr);
+		}
+		else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
+			if		constexpr (N == 2) glUniform2iv(uniform->location, 1, ptr);
+			else if	constexpr (N == 3) glUniform3iv(uniform->location, 1, ptr);
+			else if	constexpr (N == 4) glUniform4iv(uniform->location, 1, ptr);
+		}
+		else if constexpr (std::is_same_v<T, unsigned int>) {
+			if		constexpr (N == 2) glUniform2uiv(uniform->location, 1, ptr);
+			else if	constexpr (N == 3) glUniform3uiv(uniform->location, 1, ptr);
+			else if	constexpr (N == 4) glUniform4uiv(uniform->location, 1, ptr);
+		}
+		else {
+			MessageWarning("Unsupported uniform type!");
+		}
+	}
+
+	/**
+	 * Uploads an array to the given uniform, if any.
+	 *
+	 * @since 0.0.0
+	 */
+	template <typename T>
+	void upload (PipelineUniformConfig *uniform, size_t count, const T* data)
+	{
+		if (!uniform)
+			return;
+
+		if constexpr (std::is_same_v<T, float>)
+			glUniform1fv(uniform->location, count, data);
+		else if constexpr (std::is_same_v<T, int>)
+			glUniform1iv(uniform->location, count, data);
+		else if constexpr (std::is_same_v<T, unsigned int>)
+			glUniform1uiv(uniform->location, count, data);
+		else
+			MessageWarning("Unsupported uniform type!");
 	}
 
 	/**
@@ -573,6 +742,16 @@ public:
 	 * @since 0.0.0
 	 */
 	std::map<std::string, PipelineUniformConfig> uniforms;
+
+	/**
+	 * The active uniforms of this shader, indexed by their handle id.
+	 *
+	 * Entries are `nullptr` for the handles of uniforms this shader doesn't
+	 * have.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<PipelineUniformConfig*> uniformHandles;
 };
 
 }	// namespace Zen
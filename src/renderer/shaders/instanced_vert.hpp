@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource->org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_SHADERS_INSTANCED_VERT_HPP
+#define ZEN_RENDERER_SHADERS_INSTANCED_VERT_HPP
+
+#include <string>
+
+namespace Zen {
+namespace Shaders {
+
+const std::string INSTANCED_VERT =R"(
+#version 330 core
+
+// Attributes (per instance) --------------------------------------------------
+layout (location = 0) in vec4 aTransform;
+layout (location = 1) in vec2 aTranslate;
+layout (location = 2) in vec4 aFrame;
+layout (location = 3) in vec4 aParams;
+layout (location = 4) in vec4 aTint0;
+layout (location = 5) in vec4 aTint1;
+layout (location = 6) in vec4 aTint2;
+layout (location = 7) in vec4 aTint3;
+
+// Outputs --------------------------------------------------------------------
+out vec2 TexCoord;
+out float TexId;
+out float TintEffect;
+out vec4 Tint;
+
+// Uniforms -------------------------------------------------------------------
+uniform mat4 uProjectionMatrix;
+
+// Triangles A (0, 1, 2) and B (0, 2, 3) of the quad
+const int CORNERS[6] = int[6](0, 1, 2, 0, 2, 3);
+
+// ----------------------------------------------------------------------------
+void main ()
+{
+	int corner = CORNERS[gl_VertexID % 6];
+
+	// Unit square: 0 = top-left, 1 = bottom-left, 2 = bottom-right,
+	// 3 = top-right
+	float cx = (corner == 2 || corner == 3) ? 1.0 : 0.0;
+	float cy = (corner == 1 || corner == 2) ? 1.0 : 0.0;
+
+	vec2 position = vec2(
+		aTransform.x * cx + aTransform.z * cy + aTranslate.x,
+		aTransform.y * cx + aTransform.w * cy + aTranslate.y
+	);
+
+	// Round pixels
+	if (aParams.w > 0.5)
+		position = floor(position + 0.5);
+
+	gl_Position = uProjectionMatrix * vec4(position, 1.0, 1.0);
+
+	// Rotated frames swap the axes of the frame UV rectangle
+	if (aParams.z > 0.5)
+		TexCoord = vec2(mix(aFrame.x, aFrame.z, cy), mix(aFrame.y, aFrame.w, cx));
+	else
+		TexCoord = vec2(mix(aFrame.x, aFrame.z, cx), mix(aFrame.y, aFrame.w, cy));
+
+	TexId = aParams.x;
+	TintEffect = aParams.y;
+
+	if (corner == 0)
+		Tint = aTint0;
+	else if (corner == 1)
+		Tint = aTint1;
+	else if (corner == 2)
+		Tint = aTint2;
+	else
+		Tint = aTint3;
+}
+)";
+
+}	// namespace Shaders
+}	// namespace Zen
+
+#endif
@@ -12,12 +12,14 @@ out vec4 FragColor;
 // Uniforms -------------------------------------------------------------------
 uniform sampler2D uMainSampler[%count%];
 
+%arrays%
+
 // ----------------------------------------------------------------------------
 void main ()
 {
 	vec4 texture;
 
-	%forloop%
+	%arrayselect%%forloop%
 	
 	vec4 texel = vec4(Tint.bgr * Tint.a, Tint.a);
 
@@ -0,0 +1,305 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "snapshot_reader.hpp"
+
+#include <cstring>
+#include "renderer.hpp"
+#include "utility.hpp"
+#include "../display/color.hpp"
+#include "../utils/messages.hpp"
+
+namespace Zen {
+
+extern Renderer g_renderer;
+
+SnapshotReader::~SnapshotReader ()
+{
+	// The OpenGL objects are gone with the context by now, see `destroy`
+	stop();
+
+	for (auto& job_ : jobs)
+		SDL_FreeSurface(job_.surface);
+
+	for (auto& job_ : done)
+		SDL_FreeSurface(job_.surface);
+
+	if (surface)
+		SDL_FreeSurface(surface);
+}
+
+void SnapshotReader::destroy ()
+{
+	finish();
+
+	stop();
+
+	for (auto& [buffer_, size_] : bufferSizes) {
+		g_renderer.state.deleteBuffer(buffer_);
+		glDeleteBuffers(1, &buffer_);
+	}
+
+	bufferSizes.clear();
+	buffers.clear();
+}
+
+void SnapshotReader::stop ()
+{
+	if (!thread.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock_ (mutex);
+		stopping = true;
+	}
+
+	wake.notify_all();
+	thread.join();
+
+	stopping = false;
+}
+
+GLuint SnapshotReader::getBuffer (GLsizeiptr size_)
+{
+	GLuint buffer_ = 0;
+
+	if (buffers.empty()) {
+		glGenBuffers(1, &buffer_);
+		bufferSizes.push_back({buffer_, 0});
+	}
+	else {
+		buffer_ = buffers.back();
+		buffers.pop_back();
+	}
+
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, buffer_);
+
+	for (auto& [b_, s_] : bufferSizes) {
+		if (b_ == buffer_ && s_ < size_) {
+			glBufferData(GL_PIXEL_PACK_BUFFER, size_, nullptr, GL_STREAM_READ);
+			s_ = size_;
+		}
+	}
+
+	return buffer_;
+}
+
+void SnapshotReader::start (Readback& readback_, int x_, int y_)
+{
+	// Keep a bounded number of buffers in flight
+	if (pending.size() >= MAX_PENDING) {
+		glClientWaitSync(pending.front().fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+				GL_TIMEOUT_IGNORED);
+
+		collect(pending.front());
+		pending.pop_front();
+	}
+
+	readback_.buffer = getBuffer(
+			static_cast<GLsizeiptr>(readback_.width) * readback_.height * 4);
+
+	// The copy happens on the GPU, the call returns at once
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(x_, y_, readback_.width, readback_.height,
+			readback_.getPixel ? GL_RGBA : GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+
+	readback_.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	// Don't let the other reads land in the buffer
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	pending.push_back(std::move(readback_));
+}
+
+void SnapshotReader::read (int x_, int y_, int width_, int height_,
+		const std::string& path_, std::function<void(SDL_Surface*)> callback_)
+{
+	if (width_ <= 0 || height_ <= 0)
+		return;
+
+	Readback readback_;
+	readback_.width = width_;
+	readback_.height = height_;
+	readback_.path = path_;
+	readback_.callback = std::move(callback_);
+
+	start(readback_, x_, y_);
+}
+
+void SnapshotReader::readPixel (int x_, int y_,
+		std::function<void(Color)> callback_)
+{
+	Readback readback_;
+	readback_.width = 1;
+	readback_.height = 1;
+	readback_.getPixel = true;
+	readback_.callbackPixel = std::move(callback_);
+
+	start(readback_, x_, y_);
+}
+
+void SnapshotReader::collect (Readback& readback_)
+{
+	glDeleteSync(readback_.fence);
+	readback_.fence = nullptr;
+
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, readback_.buffer);
+
+	const size_t pitch_ = static_cast<size_t>(readback_.width) * 4;
+
+	const std::uint8_t *pixels_ = static_cast<const std::uint8_t*>(
+			glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, pitch_ * readback_.height,
+				GL_MAP_READ_BIT));
+
+	SDL_Surface *surface_ = nullptr;
+	Color color_;
+
+	if (!pixels_) {
+		MessageError("Failed to map the snapshot buffer.");
+	}
+	else if (readback_.getPixel) {
+		SetTo(&color_, pixels_[0], pixels_[1], pixels_[2], pixels_[3]);
+	}
+	else {
+		// GL_BGRA bytes are ARGB8888 pixels on little endian hosts, like the
+		// surfaces of the synchronous snapshots
+		surface_ = SDL_CreateRGBSurfaceWithFormat(0, readback_.width,
+				readback_.height, 32, SDL_PIXELFORMAT_ARGB8888);
+
+		if (!surface_) {
+			MessageError("Failed to create an RGB surface: ", SDL_GetError());
+		}
+		else {
+			// OpenGL rows go bottom up, so flip them while copying
+			std::uint8_t *dst_ = static_cast<std::uint8_t*>(surface_->pixels);
+
+			for (int i = 0; i < readback_.height; i++) {
+				std::memcpy(dst_ + i * surface_->pitch,
+						pixels_ + (readback_.height - 1 - i) * pitch_, pitch_);
+			}
+		}
+	}
+
+	if (pixels_)
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+	g_renderer.state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	buffers.push_back(readback_.buffer);
+
+	if (readback_.getPixel) {
+		if (pixels_ && readback_.callbackPixel)
+			readback_.callbackPixel(color_);
+
+		return;
+	}
+
+	if (!surface_)
+		return;
+
+	Job job_ {surface_, readback_.path, std::move(readback_.callback)};
+
+	if (job_.path.empty()) {
+		complete(job_);
+
+		return;
+	}
+
+	// Encode the image file in the background
+	{
+		std::lock_guard<std::mutex> lock_ (mutex);
+
+		if (!thread.joinable())
+			thread = std::thread(&SnapshotReader::work, this);
+
+		jobs.push_back(std::move(job_));
+		working++;
+	}
+
+	wake.notify_one();
+}
+
+void SnapshotReader::complete (Job& job_)
+{
+	if (surface)
+		SDL_FreeSurface(surface);
+
+	surface = job_.surface;
+
+	if (job_.callback)
+		job_.callback(surface);
+}
+
+void SnapshotReader::work ()
+{
+	std::unique_lock<std::mutex> lock_ (mutex);
+
+	while (true) {
+		wake.wait(lock_, [this] { return stopping || !jobs.empty(); });
+
+		if (jobs.empty())
+			return;
+
+		Job job_ = std::move(jobs.front());
+		jobs.pop_front();
+
+		lock_.unlock();
+
+		SaveSurface(job_.surface, job_.path);
+
+		lock_.lock();
+
+		done.push_back(std::move(job_));
+		working--;
+
+		finished.notify_all();
+	}
+}
+
+void SnapshotReader::update ()
+{
+	// The fences signal in order
+	while (!pending.empty()) {
+		GLenum status_ = glClientWaitSync(pending.front().fence, 0, 0);
+
+		if (status_ != GL_ALREADY_SIGNALED
+				&& status_ != GL_CONDITION_SATISFIED)
+			break;
+
+		collect(pending.front());
+		pending.pop_front();
+	}
+
+	std::deque<Job> done_;
+	{
+		std::lock_guard<std::mutex> lock_ (mutex);
+		done_.swap(done);
+	}
+
+	for (auto& job_ : done_)
+		complete(job_);
+}
+
+void SnapshotReader::finish ()
+{
+	while (!pending.empty()) {
+		glClientWaitSync(pending.front().fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+				GL_TIMEOUT_IGNORED);
+
+		collect(pending.front());
+		pending.pop_front();
+	}
+
+	{
+		std::unique_lock<std::mutex> lock_ (mutex);
+		finished.wait(lock_, [this] { return working == 0; });
+	}
+
+	update();
+}
+
+}	// namespace Zen
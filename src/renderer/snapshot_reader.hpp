@@ -0,0 +1,270 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_SNAPSHOT_READER_HPP
+#define ZEN_RENDERER_SNAPSHOT_READER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <GL/glew.h>
+#include "../display/types/color.hpp"
+
+namespace Zen {
+
+/**
+ * Reads the snapshots of the window back without stalling the frame.
+ *
+ * The pixels are copied into a pixel buffer object, which the GPU fills
+ * asynchronously. It is only mapped once its fence is signaled, usually a
+ * frame or two later, and the image file is then encoded on a background
+ * thread. The callbacks are always invoked on the main thread, from `update`.
+ *
+ * @since 0.0.0
+ */
+class SnapshotReader
+{
+public:
+	~SnapshotReader ();
+
+	/**
+	 * Starts reading an area of the bound read framebuffer.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param x The x coordinate of the area.
+	 * @param y The y coordinate of the area.
+	 * @param width The width of the area.
+	 * @param height The height of the area.
+	 * @param path The path of the image file to save, if any.
+	 * @param callback The function to invoke with the snapshot.
+	 */
+	void read (int x, int y, int width, int height, const std::string& path,
+			std::function<void(SDL_Surface*)> callback);
+
+	/**
+	 * Starts reading a pixel of the bound read framebuffer.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param x The x coordinate of the pixel.
+	 * @param y The y coordinate of the pixel.
+	 * @param callback The function to invoke with the color of the pixel.
+	 */
+	void readPixel (int x, int y, std::function<void(Color)> callback);
+
+	/**
+	 * Collects the readbacks the GPU is done with, and invokes the callbacks
+	 * of the snapshots that are ready. Called by the Renderer every frame.
+	 *
+	 * @since 0.0.0
+	 */
+	void update ();
+
+	/**
+	 * Waits for all the snapshots, and invokes their callbacks.
+	 *
+	 * @since 0.0.0
+	 */
+	void finish ();
+
+	/**
+	 * Finishes the snapshots in flight, stops the worker thread and deletes
+	 * the pixel buffers. Called by the Renderer while the OpenGL context is
+	 * still alive.
+	 *
+	 * @since 0.0.0
+	 */
+	void destroy ();
+
+	/**
+	 * The maximum number of readbacks waiting for the GPU. Reading another
+	 * one first waits for the oldest.
+	 *
+	 * @since 0.0.0
+	 */
+	static const size_t MAX_PENDING = 4;
+
+private:
+	/**
+	 * A snapshot being read by the GPU.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Readback
+	{
+		GLuint buffer = 0;
+		GLsync fence = nullptr;
+		int width = 0;
+		int height = 0;
+		bool getPixel = false;
+		std::string path;
+		std::function<void(SDL_Surface*)> callback;
+		std::function<void(Color)> callbackPixel;
+	};
+
+	/**
+	 * A snapshot to save on the background thread.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Job
+	{
+		SDL_Surface *surface = nullptr;
+		std::string path;
+		std::function<void(SDL_Surface*)> callback;
+	};
+
+	/**
+	 * Gets a pixel buffer of at least the given size from the pool.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param size The size of the buffer, in bytes.
+	 *
+	 * @return The buffer, bound to `GL_PIXEL_PACK_BUFFER`.
+	 */
+	GLuint getBuffer (GLsizeiptr size);
+
+	/**
+	 * Issues the read of a snapshot into a pixel buffer.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param readback The readback, with its size set.
+	 * @param x The x coordinate of the area.
+	 * @param y The y coordinate of the area.
+	 */
+	void start (Readback& readback, int x, int y);
+
+	/**
+	 * Copies the pixels of a finished readback out of its buffer, and returns
+	 * the buffer to the pool.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param readback The readback.
+	 */
+	void collect (Readback& readback);
+
+	/**
+	 * Invokes the callback of a snapshot, and keeps its surface until the next
+	 * one.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param job The finished snapshot.
+	 */
+	void complete (Job& job);
+
+	/**
+	 * The loop of the background thread, saving the image files.
+	 *
+	 * @since 0.0.0
+	 */
+	void work ();
+
+	/**
+	 * Stops the background thread, once the image files queued are saved.
+	 *
+	 * @since 0.0.0
+	 */
+	void stop ();
+
+	/**
+	 * The readbacks waiting for the GPU, oldest first.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<Readback> pending;
+
+	/**
+	 * The pixel buffers that are free to use.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<GLuint> buffers;
+
+	/**
+	 * The size of each pixel buffer, by name.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::pair<GLuint, GLsizeiptr>> bufferSizes;
+
+	/**
+	 * The background thread, started with the first image file to save.
+	 *
+	 * @since 0.0.0
+	 */
+	std::thread thread;
+
+	/**
+	 * Guards `jobs`, `done`, `working` and `stopping`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::mutex mutex;
+
+	/**
+	 * Wakes the background thread up.
+	 *
+	 * @since 0.0.0
+	 */
+	std::condition_variable wake;
+
+	/**
+	 * Signals that a job is done.
+	 *
+	 * @since 0.0.0
+	 */
+	std::condition_variable finished;
+
+	/**
+	 * The snapshots to save.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<Job> jobs;
+
+	/**
+	 * The saved snapshots, waiting for their callback.
+	 *
+	 * @since 0.0.0
+	 */
+	std::deque<Job> done;
+
+	/**
+	 * The number of jobs queued or being saved.
+	 *
+	 * @since 0.0.0
+	 */
+	int working = 0;
+
+	/**
+	 * Is the background thread asked to stop?
+	 *
+	 * @since 0.0.0
+	 */
+	bool stopping = false;
+
+	/**
+	 * The surface of the last completed snapshot, kept until the next one.
+	 *
+	 * @since 0.0.0
+	 */
+	SDL_Surface *surface = nullptr;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,268 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "sprite_corners.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace Zen {
+
+void SpriteTransforms::resize (size_t count)
+{
+	for (auto *field : {&a, &b, &c, &d, &tx, &ty, &x, &y, &width, &height})
+		field->resize(count);
+}
+
+size_t SpriteTransforms::size () const
+{
+	return a.size();
+}
+
+void SpriteCorners::resize (size_t count)
+{
+	for (int i = 0; i < 4; i++) {
+		x[i].resize(count);
+		y[i].resize(count);
+	}
+
+	visible.resize(count);
+}
+
+namespace {
+
+/**
+ * Rounds half away from zero like `std::round`, the same way as the vector
+ * code so every Sprite of a run gets the same result.
+ */
+inline float roundCorner (float value)
+{
+	return std::copysign(std::trunc(std::abs(value) + 0.5f), value);
+}
+
+#if defined(__AVX2__)
+inline __m256 roundCorners (__m256 value)
+{
+	const __m256 sign = _mm256_set1_ps(-0.f);
+	__m256 valueSign = _mm256_and_ps(value, sign);
+	__m256 abs = _mm256_andnot_ps(sign, value);
+	__m256 rounded = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(
+			_mm256_add_ps(abs, _mm256_set1_ps(0.5f))));
+
+	return _mm256_or_ps(rounded, valueSign);
+}
+#elif defined(__SSE2__)
+inline __m128 roundCorners (__m128 value)
+{
+	const __m128 sign = _mm_set1_ps(-0.f);
+	__m128 valueSign = _mm_and_ps(value, sign);
+	__m128 abs = _mm_andnot_ps(sign, value);
+	__m128 rounded = _mm_cvtepi32_ps(_mm_cvttps_epi32(
+			_mm_add_ps(abs, _mm_set1_ps(0.5f))));
+
+	return _mm_or_ps(rounded, valueSign);
+}
+#endif
+
+}	// namespace
+
+void TransformSpriteCorners (const SpriteTransforms& transforms,
+		bool roundPixels, float width, float height, SpriteCorners *corners)
+{
+	const size_t count = transforms.size();
+	corners->resize(count);
+
+	[[maybe_unused]] const auto &t = transforms;
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 screenW = _mm256_set1_ps(width);
+	const __m256 screenH = _mm256_set1_ps(height);
+
+	for (; i + 8 <= count; i += 8) {
+		__m256 a = _mm256_loadu_ps(&t.a[i]);
+		__m256 b = _mm256_loadu_ps(&t.b[i]);
+		__m256 c = _mm256_loadu_ps(&t.c[i]);
+		__m256 d = _mm256_loadu_ps(&t.d[i]);
+		__m256 x = _mm256_loadu_ps(&t.x[i]);
+		__m256 y = _mm256_loadu_ps(&t.y[i]);
+		__m256 xw = _mm256_add_ps(x, _mm256_loadu_ps(&t.width[i]));
+		__m256 yh = _mm256_add_ps(y, _mm256_loadu_ps(&t.height[i]));
+
+		// The translation plus the contribution of each local coordinate
+		__m256 ax = _mm256_mul_ps(a, x), axw = _mm256_mul_ps(a, xw);
+		__m256 bx = _mm256_mul_ps(b, x), bxw = _mm256_mul_ps(b, xw);
+		__m256 cy = _mm256_add_ps(_mm256_mul_ps(c, y),
+				_mm256_loadu_ps(&t.tx[i]));
+		__m256 cyh = _mm256_add_ps(_mm256_mul_ps(c, yh),
+				_mm256_loadu_ps(&t.tx[i]));
+		__m256 dy = _mm256_add_ps(_mm256_mul_ps(d, y),
+				_mm256_loadu_ps(&t.ty[i]));
+		__m256 dyh = _mm256_add_ps(_mm256_mul_ps(d, yh),
+				_mm256_loadu_ps(&t.ty[i]));
+
+		__m256 cx[4] = {
+			_mm256_add_ps(ax, cy), _mm256_add_ps(ax, cyh),
+			_mm256_add_ps(axw, cyh), _mm256_add_ps(axw, cy)
+		};
+		__m256 cyv[4] = {
+			_mm256_add_ps(bx, dy), _mm256_add_ps(bx, dyh),
+			_mm256_add_ps(bxw, dyh), _mm256_add_ps(bxw, dy)
+		};
+
+		if (roundPixels) {
+			for (int k = 0; k < 4; k++) {
+				cx[k] = roundCorners(cx[k]);
+				cyv[k] = roundCorners(cyv[k]);
+			}
+		}
+
+		for (int k = 0; k < 4; k++) {
+			_mm256_storeu_ps(&corners->x[k][i], cx[k]);
+			_mm256_storeu_ps(&corners->y[k][i], cyv[k]);
+		}
+
+		__m256 l = _mm256_min_ps(_mm256_min_ps(cx[0], cx[1]),
+				_mm256_min_ps(cx[2], cx[3]));
+		__m256 r = _mm256_max_ps(_mm256_max_ps(cx[0], cx[1]),
+				_mm256_max_ps(cx[2], cx[3]));
+		__m256 top = _mm256_min_ps(_mm256_min_ps(cyv[0], cyv[1]),
+				_mm256_min_ps(cyv[2], cyv[3]));
+		__m256 bottom = _mm256_max_ps(_mm256_max_ps(cyv[0], cyv[1]),
+				_mm256_max_ps(cyv[2], cyv[3]));
+
+		__m256 hidden = _mm256_or_ps(
+				_mm256_or_ps(_mm256_cmp_ps(l, screenW, _CMP_GT_OQ),
+					_mm256_cmp_ps(r, zero, _CMP_LT_OQ)),
+				_mm256_or_ps(_mm256_cmp_ps(top, screenH, _CMP_GT_OQ),
+					_mm256_cmp_ps(bottom, zero, _CMP_LT_OQ)));
+
+		int mask = _mm256_movemask_ps(hidden);
+
+		for (int k = 0; k < 8; k++)
+			corners->visible[i + k] = !((mask >> k) & 1);
+	}
+#elif defined(__SSE2__)
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 screenW = _mm_set1_ps(width);
+	const __m128 screenH = _mm_set1_ps(height);
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 a = _mm_loadu_ps(&t.a[i]);
+		__m128 b = _mm_loadu_ps(&t.b[i]);
+		__m128 c = _mm_loadu_ps(&t.c[i]);
+		__m128 d = _mm_loadu_ps(&t.d[i]);
+		__m128 x = _mm_loadu_ps(&t.x[i]);
+		__m128 y = _mm_loadu_ps(&t.y[i]);
+		__m128 xw = _mm_add_ps(x, _mm_loadu_ps(&t.width[i]));
+		__m128 yh = _mm_add_ps(y, _mm_loadu_ps(&t.height[i]));
+
+		// The translation plus the contribution of each local coordinate
+		__m128 ax = _mm_mul_ps(a, x), axw = _mm_mul_ps(a, xw);
+		__m128 bx = _mm_mul_ps(b, x), bxw = _mm_mul_ps(b, xw);
+		__m128 cy = _mm_add_ps(_mm_mul_ps(c, y), _mm_loadu_ps(&t.tx[i]));
+		__m128 cyh = _mm_add_ps(_mm_mul_ps(c, yh), _mm_loadu_ps(&t.tx[i]));
+		__m128 dy = _mm_add_ps(_mm_mul_ps(d, y), _mm_loadu_ps(&t.ty[i]));
+		__m128 dyh = _mm_add_ps(_mm_mul_ps(d, yh), _mm_loadu_ps(&t.ty[i]));
+
+		__m128 cx[4] = {
+			_mm_add_ps(ax, cy), _mm_add_ps(ax, cyh),
+			_mm_add_ps(axw, cyh), _mm_add_ps(axw, cy)
+		};
+		__m128 cyv[4] = {
+			_mm_add_ps(bx, dy), _mm_add_ps(bx, dyh),
+			_mm_add_ps(bxw, dyh), _mm_add_ps(bxw, dy)
+		};
+
+		if (roundPixels) {
+			for (int k = 0; k < 4; k++) {
+				cx[k] = roundCorners(cx[k]);
+				cyv[k] = roundCorners(cyv[k]);
+			}
+		}
+
+		for (int k = 0; k < 4; k++) {
+			_mm_storeu_ps(&corners->x[k][i], cx[k]);
+			_mm_storeu_ps(&corners->y[k][i], cyv[k]);
+		}
+
+		__m128 l = _mm_min_ps(_mm_min_ps(cx[0], cx[1]),
+				_mm_min_ps(cx[2], cx[3]));
+		__m128 r = _mm_max_ps(_mm_max_ps(cx[0], cx[1]),
+				_mm_max_ps(cx[2], cx[3]));
+		__m128 top = _mm_min_ps(_mm_min_ps(cyv[0], cyv[1]),
+				_mm_min_ps(cyv[2], cyv[3]));
+		__m128 bottom = _mm_max_ps(_mm_max_ps(cyv[0], cyv[1]),
+				_mm_max_ps(cyv[2], cyv[3]));
+
+		__m128 hidden = _mm_or_ps(
+				_mm_or_ps(_mm_cmpgt_ps(l, screenW), _mm_cmplt_ps(r, zero)),
+				_mm_or_ps(_mm_cmpgt_ps(top, screenH),
+					_mm_cmplt_ps(bottom, zero)));
+
+		int mask = _mm_movemask_ps(hidden);
+
+		for (int k = 0; k < 4; k++)
+			corners->visible[i + k] = !((mask >> k) & 1);
+	}
+#endif
+
+	// The Sprites left over by the vector code, or all of them without it
+	TransformSpriteCornersScalar(transforms, roundPixels, width, height,
+			corners, i);
+}
+
+void TransformSpriteCornersScalar (const SpriteTransforms& transforms,
+		bool roundPixels, float width, float height, SpriteCorners *corners,
+		size_t first)
+{
+	const auto &t = transforms;
+
+	for (size_t i = first; i < t.size(); i++) {
+		float x = t.x[i], y = t.y[i];
+		float xw = x + t.width[i], yh = y + t.height[i];
+
+		std::array<float, 4> lx = {x, x, xw, xw};
+		std::array<float, 4> ly = {y, yh, yh, y};
+
+		float l = width, r = 0.f, top = height, bottom = 0.f;
+
+		for (int k = 0; k < 4; k++) {
+			float cx = t.a[i] * lx[k] + (t.c[i] * ly[k] + t.tx[i]);
+			float cy = t.b[i] * lx[k] + (t.d[i] * ly[k] + t.ty[i]);
+
+			if (roundPixels) {
+				cx = roundCorner(cx);
+				cy = roundCorner(cy);
+			}
+
+			corners->x[k][i] = cx;
+			corners->y[k][i] = cy;
+
+			if (k == 0) {
+				l = r = cx;
+				top = bottom = cy;
+			}
+			else {
+				l = std::min(l, cx);
+				r = std::max(r, cx);
+				top = std::min(top, cy);
+				bottom = std::max(bottom, cy);
+			}
+		}
+
+		corners->visible[i] = !(l > width || r < 0.f || top > height
+				|| bottom < 0.f);
+	}
+}
+
+}	// namespace Zen
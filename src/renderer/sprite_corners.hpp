@@ -0,0 +1,114 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_SPRITE_CORNERS_HPP
+#define ZEN_RENDERER_SPRITE_CORNERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * The transforms of a run of Sprites, stored as one array per field so they
+ * can be processed several at once.
+ *
+ * Each Sprite has a local quad, starting at `x`, `y` and of size `width` by
+ * `height`, and the matrix bringing it to screen space.
+ *
+ * @since 0.0.0
+ */
+struct SpriteTransforms
+{
+	std::vector<float> a, b, c, d, tx, ty;
+
+	std::vector<float> x, y, width, height;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param count The number of Sprites.
+	 */
+	void resize (size_t count);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of Sprites.
+	 */
+	size_t size () const;
+};
+
+/**
+ * The screen space corners of a run of Sprites, in the order top-left,
+ * bottom-left, bottom-right and top-right, with one array per corner and
+ * axis.
+ *
+ * @since 0.0.0
+ */
+struct SpriteCorners
+{
+	std::array<std::vector<float>, 4> x;
+
+	std::array<std::vector<float>, 4> y;
+
+	/**
+	 * Whether each Sprite is at least partly on the screen.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<std::uint8_t> visible;
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param count The number of Sprites.
+	 */
+	void resize (size_t count);
+};
+
+/**
+ * Transforms the corners of a run of Sprites to screen space, and checks
+ * whether they are visible, in a single pass.
+ *
+ * Uses AVX2 or SSE2 when the library is built for them, and plain code for
+ * the remaining Sprites.
+ *
+ * @since 0.0.0
+ *
+ * @param transforms The transforms of the Sprites.
+ * @param roundPixels Whether to round the corners to the nearest pixel.
+ * @param width The width of the screen.
+ * @param height The height of the screen.
+ * @param corners The corners to fill, resized to fit the Sprites.
+ */
+void TransformSpriteCorners (const SpriteTransforms& transforms,
+		bool roundPixels, float width, float height, SpriteCorners *corners);
+
+/**
+ * The plain code of `TransformSpriteCorners`, used for the Sprites left over
+ * by the vector code. It gives the reference results to check the vector code
+ * against.
+ *
+ * @since 0.0.0
+ *
+ * @param transforms The transforms of the Sprites.
+ * @param roundPixels Whether to round the corners to the nearest pixel.
+ * @param width The width of the screen.
+ * @param height The height of the screen.
+ * @param corners The corners to fill, already sized to fit the Sprites.
+ * @param first The first Sprite to transform.
+ */
+void TransformSpriteCornersScalar (const SpriteTransforms& transforms,
+		bool roundPixels, float width, float height, SpriteCorners *corners,
+		size_t first = 0);
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,426 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "state_cache.hpp"
+
+#include <cmath>
+
+namespace Zen {
+
+StateCache::StateCache ()
+{
+	invalidate();
+}
+
+void StateCache::invalidate ()
+{
+	activeUnit = UNKNOWN;
+	textures2D.fill(UNKNOWN);
+	texturesArray.fill(UNKNOWN);
+
+	program = UNKNOWN;
+	vertexArray = UNKNOWN;
+	arrayBuffer = UNKNOWN;
+	elementBuffer = UNKNOWN;
+	pixelPackBuffer = UNKNOWN;
+	drawFramebuffer = UNKNOWN;
+	readFramebuffer = UNKNOWN;
+
+	capabilities.fill(-1);
+	blendEquations.fill(UNKNOWN);
+	blendFuncs.fill(UNKNOWN);
+	stencilFuncs.fill(UNKNOWN);
+	stencilOps.fill(UNKNOWN);
+	depthMaskValue = -1;
+	depthFuncValue = UNKNOWN;
+	colorMaskBits = -1;
+	scissorBox.fill(-1);
+	viewportBox.fill(-1);
+	clearColorKnown = false;
+}
+
+void StateCache::beginFrame ()
+{
+	lastFrameCalls = frameCalls;
+	lastFrameSavedCalls = frameSavedCalls;
+
+	frameCalls = 0;
+	frameSavedCalls = 0;
+
+	frameTextureBinds = 0;
+	frameProgramSwitches = 0;
+	frameFramebufferSwitches = 0;
+}
+
+bool StateCache::check (bool changed)
+{
+	if (changed)
+		frameCalls++;
+	else
+		frameSavedCalls++;
+
+	return changed;
+}
+
+void StateCache::record (const char *name,
+		std::array<std::int64_t, 4> values)
+{
+	if (log)
+		log->recordState(name, values);
+}
+
+void StateCache::activeTexture (GLenum unit)
+{
+	if (check(activeUnit != unit)) {
+		glActiveTexture(unit);
+		activeUnit = unit;
+
+		record("activeTexture", {unit, 0, 0, 0});
+	}
+}
+
+void StateCache::bindTexture (GLenum target, GL_texture texture)
+{
+	GLuint index = activeUnit - GL_TEXTURE0;
+	GL_texture *slot = nullptr;
+
+	if (activeUnit != UNKNOWN && index < MAX_UNITS) {
+		if (target == GL_TEXTURE_2D)
+			slot = &textures2D[index];
+		else if (target == GL_TEXTURE_2D_ARRAY)
+			slot = &texturesArray[index];
+	}
+
+	if (!slot) {
+		check(true);
+		glBindTexture(target, texture);
+
+		frameTextureBinds++;
+		record("bindTexture", {activeUnit, target, texture, 0});
+	}
+	else if (check(*slot != texture)) {
+		glBindTexture(target, texture);
+		*slot = texture;
+
+		frameTextureBinds++;
+		record("bindTexture", {activeUnit, target, texture, 0});
+	}
+}
+
+void StateCache::bindTexture (GLenum unit, GLenum target, GL_texture texture)
+{
+	activeTexture(unit);
+	bindTexture(target, texture);
+}
+
+GL_texture StateCache::getTexture2D ()
+{
+	GLuint index = activeUnit - GL_TEXTURE0;
+
+	if (activeUnit == UNKNOWN || index >= MAX_UNITS
+			|| textures2D[index] == UNKNOWN)
+		return 0;
+
+	return textures2D[index];
+}
+
+void StateCache::useProgram (GL_program program_)
+{
+	if (check(program != program_)) {
+		glUseProgram(program_);
+		program = program_;
+
+		frameProgramSwitches++;
+		record("useProgram", {program_, 0, 0, 0});
+	}
+}
+
+void StateCache::bindVertexArray (GL_vao vertexArray_)
+{
+	if (check(vertexArray != vertexArray_)) {
+		glBindVertexArray(vertexArray_);
+		vertexArray = vertexArray_;
+
+		record("bindVertexArray", {vertexArray_, 0, 0, 0});
+
+		// The element buffer binding belongs to the vertex array
+		elementBuffer = UNKNOWN;
+	}
+}
+
+bool StateCache::bindBuffer (GLenum target, GLuint buffer)
+{
+	GLuint *slot = nullptr;
+
+	switch (target) {
+		case GL_ARRAY_BUFFER:
+			slot = &arrayBuffer;
+			break;
+		case GL_ELEMENT_ARRAY_BUFFER:
+			slot = &elementBuffer;
+			break;
+		case GL_PIXEL_PACK_BUFFER:
+			slot = &pixelPackBuffer;
+			break;
+		default:
+			break;
+	}
+
+	if (slot && !check(*slot != buffer))
+		return false;
+
+	if (slot)
+		*slot = buffer;
+	else
+		check(true);
+
+	glBindBuffer(target, buffer);
+
+	record("bindBuffer", {target, buffer, 0, 0});
+
+	return true;
+}
+
+void StateCache::bindFramebuffer (GLenum target, GL_fbo framebuffer)
+{
+	bool draw_ = (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER);
+	bool read_ = (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER);
+
+	bool changed_ = (draw_ && drawFramebuffer != framebuffer)
+		|| (read_ && readFramebuffer != framebuffer);
+
+	if (check(changed_)) {
+		glBindFramebuffer(target, framebuffer);
+
+		if (draw_)
+			drawFramebuffer = framebuffer;
+		if (read_)
+			readFramebuffer = framebuffer;
+
+		frameFramebufferSwitches++;
+		record("bindFramebuffer", {target, framebuffer, 0, 0});
+	}
+}
+
+int StateCache::getCapabilityIndex (GLenum capability)
+{
+	switch (capability) {
+		case GL_BLEND:
+			return 0;
+		case GL_SCISSOR_TEST:
+			return 1;
+		case GL_STENCIL_TEST:
+			return 2;
+		case GL_DEPTH_TEST:
+			return 3;
+		case GL_CULL_FACE:
+			return 4;
+		default:
+			return -1;
+	}
+}
+
+void StateCache::setCapability (GLenum capability, bool enabled)
+{
+	int index_ = getCapabilityIndex(capability);
+
+	if (index_ >= 0 && !check(capabilities[index_] != enabled))
+		return;
+
+	if (index_ < 0)
+		check(true);
+	else
+		capabilities[index_] = enabled;
+
+	if (enabled)
+		glEnable(capability);
+	else
+		glDisable(capability);
+
+	record(enabled ? "enable" : "disable", {capability, 0, 0, 0});
+}
+
+void StateCache::enable (GLenum capability)
+{
+	setCapability(capability, true);
+}
+
+void StateCache::disable (GLenum capability)
+{
+	setCapability(capability, false);
+}
+
+void StateCache::blendEquation (GLenum rgb, GLenum alpha)
+{
+	std::array<GLenum, 2> value_ {rgb, alpha};
+
+	if (check(blendEquations != value_)) {
+		if (rgb == alpha)
+			glBlendEquation(rgb);
+		else
+			glBlendEquationSeparate(rgb, alpha);
+
+		blendEquations = value_;
+
+		record("blendEquation", {rgb, alpha, 0, 0});
+	}
+}
+
+void StateCache::blendFunc (GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
+		GLenum dstAlpha)
+{
+	std::array<GLenum, 4> value_ {srcRGB, dstRGB, srcAlpha, dstAlpha};
+
+	if (check(blendFuncs != value_)) {
+		if (srcRGB == srcAlpha && dstRGB == dstAlpha)
+			glBlendFunc(srcRGB, dstRGB);
+		else
+			glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+		blendFuncs = value_;
+
+		record("blendFunc", {srcRGB, dstRGB, srcAlpha, dstAlpha});
+	}
+}
+
+void StateCache::stencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+	std::array<GLuint, 3> value_ {func, static_cast<GLuint>(ref), mask};
+
+	if (check(stencilFuncs != value_)) {
+		glStencilFunc(func, ref, mask);
+		stencilFuncs = value_;
+
+		record("stencilFunc", {func, ref, mask, 0});
+	}
+}
+
+void StateCache::stencilOp (GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+	std::array<GLenum, 3> value_ {sfail, dpfail, dppass};
+
+	if (check(stencilOps != value_)) {
+		glStencilOp(sfail, dpfail, dppass);
+		stencilOps = value_;
+
+		record("stencilOp", {sfail, dpfail, dppass, 0});
+	}
+}
+
+void StateCache::depthMask (bool enabled)
+{
+	if (check(depthMaskValue != enabled)) {
+		glDepthMask(enabled);
+		depthMaskValue = enabled;
+
+		record("depthMask", {enabled, 0, 0, 0});
+	}
+}
+
+void StateCache::depthFunc (GLenum func)
+{
+	if (check(depthFuncValue != func)) {
+		glDepthFunc(func);
+		depthFuncValue = func;
+
+		record("depthFunc", {func, 0, 0, 0});
+	}
+}
+
+void StateCache::colorMask (bool red, bool green, bool blue, bool alpha)
+{
+	int bits_ = red | (green << 1) | (blue << 2) | (alpha << 3);
+
+	if (check(colorMaskBits != bits_)) {
+		glColorMask(red, green, blue, alpha);
+		colorMaskBits = bits_;
+
+		record("colorMask", {red, green, blue, alpha});
+	}
+}
+
+void StateCache::scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	std::array<GLint, 4> value_ {x, y, width, height};
+
+	if (check(scissorBox != value_)) {
+		glScissor(x, y, width, height);
+		scissorBox = value_;
+
+		record("scissor", {x, y, width, height});
+	}
+}
+
+void StateCache::viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	std::array<GLint, 4> value_ {x, y, width, height};
+
+	if (check(viewportBox != value_)) {
+		glViewport(x, y, width, height);
+		viewportBox = value_;
+
+		record("viewport", {x, y, width, height});
+	}
+}
+
+void StateCache::clearColor (GLfloat red, GLfloat green, GLfloat blue,
+		GLfloat alpha)
+{
+	std::array<GLfloat, 4> value_ {red, green, blue, alpha};
+
+	if (check(!clearColorKnown || clearColorValue != value_)) {
+		glClearColor(red, green, blue, alpha);
+		clearColorValue = value_;
+		clearColorKnown = true;
+
+		// In 8 bits per channel, the log only holds integers
+		record("clearColor", {std::lround(red * 255), std::lround(green * 255),
+				std::lround(blue * 255), std::lround(alpha * 255)});
+	}
+}
+
+void StateCache::deleteTexture (GL_texture texture)
+{
+	for (auto &bound : textures2D)
+		if (bound == texture)
+			bound = 0;
+
+	for (auto &bound : texturesArray)
+		if (bound == texture)
+			bound = 0;
+}
+
+void StateCache::deleteBuffer (GLuint buffer)
+{
+	if (arrayBuffer == buffer)
+		arrayBuffer = 0;
+
+	if (elementBuffer == buffer)
+		elementBuffer = 0;
+
+	if (pixelPackBuffer == buffer)
+		pixelPackBuffer = 0;
+}
+
+void StateCache::deleteVertexArray (GL_vao vertexArray_)
+{
+	if (vertexArray == vertexArray_) {
+		vertexArray = 0;
+		elementBuffer = UNKNOWN;
+	}
+}
+
+void StateCache::deleteFramebuffer (GL_fbo framebuffer)
+{
+	if (drawFramebuffer == framebuffer)
+		drawFramebuffer = 0;
+
+	if (readFramebuffer == framebuffer)
+		readFramebuffer = 0;
+}
+
+}	// namespace Zen
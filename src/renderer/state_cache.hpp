@@ -0,0 +1,429 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_STATE_CACHE_HPP
+#define ZEN_RENDERER_STATE_CACHE_HPP
+
+#include <array>
+#include <GL/glew.h>
+#include "types/gl_types.hpp"
+#include "command_log.hpp"
+
+namespace Zen {
+
+/**
+ * The State Cache keeps a shadow copy of the OpenGL state set by the renderer,
+ * and drops any call that would set a state to the value it already has.
+ *
+ * It covers the texture units, program, vertex array, buffer bindings, blend,
+ * stencil, depth, color mask, scissor, viewport, clear color and framebuffer
+ * states.
+ * All the renderer code should go through it instead of calling these
+ * functions directly, otherwise the shadow goes out of sync. Code that has to
+ * touch the state behind its back must call `invalidate` afterwards.
+ *
+ * The `Renderer` owns a single instance of the State Cache, which you can
+ * access via the `Renderer::state` property.
+ *
+ * @since 0.0.0
+ */
+class StateCache
+{
+public:
+	/**
+	 * @since 0.0.0
+	 */
+	StateCache ();
+
+	/**
+	 * Forgets every cached value, so the next call of each setter reaches
+	 * OpenGL.
+	 *
+	 * @since 0.0.0
+	 */
+	void invalidate ();
+
+	/**
+	 * Rolls the call counters of the current frame over to the `lastFrame`
+	 * ones, and clears the binding counters. Called by the Renderer at the start of every frame.
+	 *
+	 * @since 0.0.0
+	 */
+	void beginFrame ();
+
+	/**
+	 * Selects the active texture unit.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param unit The texture unit, i.e. `GL_TEXTURE0 + n`.
+	 */
+	void activeTexture (GLenum unit);
+
+	/**
+	 * Binds a texture to the active texture unit.
+	 *
+	 * Only `GL_TEXTURE_2D` and `GL_TEXTURE_2D_ARRAY` are cached.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param target The texture target.
+	 * @param texture The texture to bind.
+	 */
+	void bindTexture (GLenum target, GL_texture texture);
+
+	/**
+	 * Binds a texture to the given texture unit.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param unit The texture unit, i.e. `GL_TEXTURE0 + n`.
+	 * @param target The texture target.
+	 * @param texture The texture to bind.
+	 */
+	void bindTexture (GLenum unit, GLenum target, GL_texture texture);
+
+	/**
+	 * The texture bound to the 2D target of the active texture unit, or `0` if
+	 * unknown.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @return The texture.
+	 */
+	GL_texture getTexture2D ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param program The program to use.
+	 */
+	void useProgram (GL_program program);
+
+	/**
+	 * Binds a vertex array.
+	 *
+	 * As the element array buffer binding is part of the vertex array state,
+	 * changing the vertex array forgets it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param vertexArray The vertex array to bind.
+	 */
+	void bindVertexArray (GL_vao vertexArray);
+
+	/**
+	 * Binds a buffer.
+	 *
+	 * Only `GL_ARRAY_BUFFER`, `GL_ELEMENT_ARRAY_BUFFER` and
+	 * `GL_PIXEL_PACK_BUFFER` are cached.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param target The buffer target.
+	 * @param buffer The buffer to bind.
+	 *
+	 * @return `true` if the binding was changed, otherwise `false`.
+	 */
+	bool bindBuffer (GLenum target, GLuint buffer);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param target The framebuffer target.
+	 * @param framebuffer The framebuffer to bind.
+	 */
+	void bindFramebuffer (GLenum target, GL_fbo framebuffer);
+
+	/**
+	 * Enables or disables a capability.
+	 *
+	 * Only `GL_BLEND`, `GL_SCISSOR_TEST`, `GL_STENCIL_TEST`, `GL_DEPTH_TEST` and
+	 * `GL_CULL_FACE` are cached.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param capability The capability.
+	 * @param enabled Should it be enabled?
+	 */
+	void setCapability (GLenum capability, bool enabled);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param capability The capability to enable.
+	 */
+	void enable (GLenum capability);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param capability The capability to disable.
+	 */
+	void disable (GLenum capability);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param rgb The blend equation of the color channels.
+	 * @param alpha The blend equation of the alpha channel.
+	 */
+	void blendEquation (GLenum rgb, GLenum alpha);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param srcRGB The source factor of the color channels.
+	 * @param dstRGB The destination factor of the color channels.
+	 * @param srcAlpha The source factor of the alpha channel.
+	 * @param dstAlpha The destination factor of the alpha channel.
+	 */
+	void blendFunc (GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
+			GLenum dstAlpha);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param func The stencil test function.
+	 * @param ref The reference value of the test.
+	 * @param mask The mask ANDed with the reference and stored values.
+	 */
+	void stencilFunc (GLenum func, GLint ref, GLuint mask);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param sfail The action when the stencil test fails.
+	 * @param dpfail The action when the depth test fails.
+	 * @param dppass The action when both tests pass.
+	 */
+	void stencilOp (GLenum sfail, GLenum dpfail, GLenum dppass);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param enabled Should the depth buffer be written?
+	 */
+	void depthMask (bool enabled);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param func The depth test function.
+	 */
+	void depthFunc (GLenum func);
+
+	/**
+	 * @since 0.0.0
+	 */
+	void colorMask (bool red, bool green, bool blue, bool alpha);
+
+	/**
+	 * @since 0.0.0
+	 */
+	void scissor (GLint x, GLint y, GLsizei width, GLsizei height);
+
+	/**
+	 * @since 0.0.0
+	 */
+	void viewport (GLint x, GLint y, GLsizei width, GLsizei height);
+
+	/**
+	 * @since 0.0.0
+	 */
+	void clearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+	/**
+	 * Forgets the bindings of a texture about to be deleted, as OpenGL
+	 * unbinds it from every unit.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param texture The deleted texture.
+	 */
+	void deleteTexture (GL_texture texture);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param buffer The deleted buffer.
+	 */
+	void deleteBuffer (GLuint buffer);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param vertexArray The deleted vertex array.
+	 */
+	void deleteVertexArray (GL_vao vertexArray);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param framebuffer The deleted framebuffer.
+	 */
+	void deleteFramebuffer (GL_fbo framebuffer);
+
+	/**
+	 * The number of state calls issued to OpenGL this frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameCalls = 0;
+
+	/**
+	 * The number of redundant state calls dropped this frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameSavedCalls = 0;
+
+	/**
+	 * The number of state calls issued to OpenGL during the last frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int lastFrameCalls = 0;
+
+	/**
+	 * The number of redundant state calls dropped during the last frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int lastFrameSavedCalls = 0;
+
+	/**
+	 * The number of textures bound this frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameTextureBinds = 0;
+
+	/**
+	 * The number of programs used this frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameProgramSwitches = 0;
+
+	/**
+	 * The number of framebuffers bound this frame.
+	 *
+	 * @since 0.0.0
+	 */
+	int frameFramebufferSwitches = 0;
+
+	/**
+	 * The log to record the state changes in, with the
+	 * `RENDER_BACKEND::RECORD` backend. The changes are still made, as the
+	 * resources are created through the same bindings.
+	 *
+	 * @since 0.0.0
+	 */
+	CommandLog *log = nullptr;
+
+private:
+	/**
+	 * Records a state change in the log, if any.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param name The state that changed.
+	 * @param values The new values.
+	 */
+	void record (const char *name, std::array<std::int64_t, 4> values);
+
+	/**
+	 * Counts a call, and whether it reaches OpenGL.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param changed Does the call change the state?
+	 *
+	 * @return `changed`
+	 */
+	bool check (bool changed);
+
+	/**
+	 * The index of a cached capability, `-1` if it isn't cached.
+	 *
+	 * @since 0.0.0
+	 */
+	int getCapabilityIndex (GLenum capability);
+
+	/**
+	 * The value used for states that aren't known.
+	 *
+	 * @since 0.0.0
+	 */
+	static constexpr GLuint UNKNOWN = ~0u;
+
+	/**
+	 * The number of texture units tracked.
+	 *
+	 * @since 0.0.0
+	 */
+	static constexpr int MAX_UNITS = 32;
+
+	GLenum activeUnit = UNKNOWN;
+
+	std::array<GL_texture, MAX_UNITS> textures2D;
+
+	std::array<GL_texture, MAX_UNITS> texturesArray;
+
+	GL_program program = UNKNOWN;
+
+	GL_vao vertexArray = UNKNOWN;
+
+	GLuint arrayBuffer = UNKNOWN;
+
+	GLuint elementBuffer = UNKNOWN;
+
+	GLuint pixelPackBuffer = UNKNOWN;
+
+	GL_fbo drawFramebuffer = UNKNOWN;
+
+	GL_fbo readFramebuffer = UNKNOWN;
+
+	/**
+	 * The cached capabilities, `-1` if unknown, otherwise `0` or `1`.
+	 *
+	 * @since 0.0.0
+	 */
+	std::array<int, 5> capabilities {-1, -1, -1, -1, -1};
+
+	std::array<GLenum, 2> blendEquations {UNKNOWN, UNKNOWN};
+
+	std::array<GLenum, 4> blendFuncs {UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN};
+
+	std::array<GLuint, 3> stencilFuncs {UNKNOWN, UNKNOWN, UNKNOWN};
+
+	std::array<GLenum, 3> stencilOps {UNKNOWN, UNKNOWN, UNKNOWN};
+
+	/**
+	 * The cached depth mask, `-1` if unknown, otherwise `0` or `1`.
+	 *
+	 * @since 0.0.0
+	 */
+	int depthMaskValue = -1;
+
+	GLenum depthFuncValue = UNKNOWN;
+
+	int colorMaskBits = -1;
+
+	std::array<GLint, 4> scissorBox {-1, -1, -1, -1};
+
+	std::array<GLint, 4> viewportBox {-1, -1, -1, -1};
+
+	bool clearColorKnown = false;
+
+	std::array<GLfloat, 4> clearColorValue {0, 0, 0, 0};
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "texture_arrays.hpp"
+
+#include <algorithm>
+#include "renderer.hpp"
+#include "../texture/components/source.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern Renderer g_renderer;
+
+TextureArrays::~TextureArrays ()
+{
+	for (auto &array_ : arrays)
+		if (array_.texture)
+			glDeleteTextures(1, &array_.texture);
+
+	if (copyFramebuffer)
+		glDeleteFramebuffers(1, &copyFramebuffer);
+}
+
+void TextureArrays::boot (int firstUnit_, int unitCount_, int maxLayers_,
+		int maxSize_)
+{
+	firstUnit = firstUnit_;
+	units = unitCount_;
+	maxLayers = std::clamp(maxLayers_, 1, MAX_LAYERS);
+	maxSize = maxSize_;
+
+	unitIndexes.clear();
+	for (int i = 0; i < units; i++)
+		unitIndexes.push_back(firstUnit + i);
+
+	boundArrays.assign(units, -1);
+}
+
+bool TextureArrays::add (Entity source_, SDL_Surface *surface_, GLenum format_,
+		GLenum minFilter_, GLenum magFilter_)
+{
+	auto src_ = g_registry.try_get<Components::TextureSource>(source_);
+
+	if (!units || !src_ || !surface_ || surface_->w > maxSize
+			|| surface_->h > maxSize)
+		return false;
+
+	// Find an array of the same size and filtering with a free layer
+	int index_ = -1;
+	int layer_ = -1;
+
+	for (size_t i = 0; i < arrays.size() && layer_ < 0; i++) {
+		auto &array_ = arrays[i];
+
+		if (array_.width != surface_->w || array_.height != surface_->h
+				|| array_.minFilter != minFilter_
+				|| array_.magFilter != magFilter_)
+			continue;
+
+		auto free_ = std::find(array_.layers.begin(), array_.layers.end(),
+				entt::null);
+
+		if (free_ != array_.layers.end()) {
+			index_ = i;
+			layer_ = free_ - array_.layers.begin();
+		}
+		else if (static_cast<int>(array_.layers.size()) < maxLayers) {
+			index_ = i;
+			layer_ = array_.layers.size();
+
+			allocate(&array_, std::min<int>(array_.layers.size() * 2,
+						maxLayers));
+		}
+	}
+
+	if (layer_ < 0) {
+		index_ = arrays.size();
+		layer_ = 0;
+
+		TextureArray array_;
+		array_.width = surface_->w;
+		array_.height = surface_->h;
+		array_.minFilter = minFilter_;
+		array_.magFilter = magFilter_;
+
+		arrays.emplace_back(array_);
+		allocate(&arrays.back(), std::min(4, maxLayers));
+	}
+
+	auto &array_ = arrays[index_];
+	array_.layers[layer_] = source_;
+
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D_ARRAY,
+			array_.texture);
+
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer_, array_.width,
+			array_.height, 1, format_, GL_UNSIGNED_BYTE, surface_->pixels);
+
+	if (minFilter_ != GL_NEAREST && minFilter_ != GL_LINEAR)
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+
+	src_->glArray = index_;
+	src_->glLayer = layer_;
+
+	return true;
+}
+
+void TextureArrays::allocate (TextureArray *array_, int layers_)
+{
+	GL_texture texture_;
+	glGenTextures(1, &texture_);
+
+	g_renderer.state.bindTexture(GL_TEXTURE0, GL_TEXTURE_2D_ARRAY, texture_);
+
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+			array_->minFilter);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER,
+			array_->magFilter);
+
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, array_->width,
+			array_->height, layers_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+	// Copy the layers of the previous storage through a framebuffer, as
+	// OpenGL 3.3 can't copy between textures directly
+	if (array_->texture) {
+		if (!copyFramebuffer)
+			glGenFramebuffers(1, &copyFramebuffer);
+
+		GLint previous_ = 0;
+		glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_);
+
+		g_renderer.state.bindFramebuffer(GL_READ_FRAMEBUFFER, copyFramebuffer);
+
+		for (size_t i = 0; i < array_->layers.size(); i++) {
+			glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+					array_->texture, 0, i);
+
+			glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, 0, 0,
+					array_->width, array_->height);
+		}
+
+		g_renderer.state.bindFramebuffer(GL_READ_FRAMEBUFFER, previous_);
+
+		g_renderer.state.deleteTexture(array_->texture);
+		glDeleteTextures(1, &array_->texture);
+	}
+
+	array_->texture = texture_;
+	array_->layers.resize(layers_, entt::null);
+
+	// The previous storage may still be bound for the current batch
+	if (array_->unit >= 0)
+		boundArrays[array_->unit] = -1;
+
+	array_->unit = -1;
+}
+
+void TextureArrays::remove (Entity source_)
+{
+	auto src_ = g_registry.try_get<Components::TextureSource>(source_);
+
+	if (!src_ || src_->glArray < 0)
+		return;
+
+	arrays[src_->glArray].layers[src_->glLayer] = entt::null;
+	src_->glArray = -1;
+}
+
+int TextureArrays::bind (Entity source_, int batch_)
+{
+	auto src_ = g_registry.try_get<Components::TextureSource>(source_);
+	auto &array_ = arrays[src_->glArray];
+
+	if (batch != batch_) {
+		for (auto &bound_ : boundArrays) {
+			if (bound_ >= 0)
+				arrays[bound_].unit = -1;
+
+			bound_ = -1;
+		}
+
+		batch = batch_;
+	}
+
+	if (array_.unit < 0) {
+		auto free_ = std::find(boundArrays.begin(), boundArrays.end(), -1);
+
+		if (free_ == boundArrays.end())
+			return 0;
+
+		array_.unit = free_ - boundArrays.begin();
+		*free_ = src_->glArray;
+
+		g_renderer.state.bindTexture(GL_TEXTURE0 + firstUnit + array_.unit,
+				GL_TEXTURE_2D_ARRAY, array_.texture);
+	}
+
+	// Negative ids, so the shaders tell them from the 2D texture units
+	return -1 - (array_.unit * MAX_LAYERS + src_->glLayer);
+}
+
+}	// namespace Zen
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_TEXTURE_ARRAYS_HPP
+#define ZEN_RENDERER_TEXTURE_ARRAYS_HPP
+
+#include <vector>
+#include <SDL2/SDL_surface.h>
+#include "types/gl_types.hpp"
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Packs the Texture Sources of the same size into the layers of
+ * `GL_TEXTURE_2D_ARRAY` textures, so a single texture unit serves all of
+ * them and the Multi Pipeline doesn't have to flush when it runs out of units.
+ *
+ * The arrays are bound to their own units, after the ones used by the 2D
+ * textures, and sampled by layer index by the shaders built with the
+ * `%arrays%` and `%arrayselect%` placeholders. A Texture Source keeps its 2D
+ * texture, used by the other pipelines.
+ *
+ * It is enabled with the `RenderConfig::textureArrays` option.
+ *
+ * @since 0.0.0
+ */
+class TextureArrays
+{
+public:
+	~TextureArrays ();
+
+	/**
+	 * The maximum number of layers of an array. This is the minimum
+	 * `GL_MAX_ARRAY_TEXTURE_LAYERS` of OpenGL 3.3, and the stride between two
+	 * texture units in the texture ids written in the vertices.
+	 *
+	 * @since 0.0.0
+	 */
+	static const int MAX_LAYERS = 256;
+
+	/**
+	 * Sets up the texture units of the arrays.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param firstUnit The first texture unit of the arrays.
+	 * @param unitCount The number of texture units of the arrays.
+	 * @param maxLayers The maximum number of layers of an array.
+	 * @param maxSize The maximum width and height of a packed Texture Source.
+	 */
+	void boot (int firstUnit, int unitCount, int maxLayers, int maxSize);
+
+	/**
+	 * Uploads a Texture Source into a layer of the array of its size,
+	 * creating or growing the array if needed.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param source The Texture Source entity.
+	 * @param surface The pixels of the Texture Source.
+	 * @param format The format of the pixels.
+	 * @param minFilter The minification filter of the array.
+	 * @param magFilter The magnification filter of the array.
+	 *
+	 * @return `true` if the Texture Source was packed, `false` if it doesn't
+	 * fit in an array.
+	 */
+	bool add (Entity source, SDL_Surface *surface, GLenum format,
+			GLenum minFilter, GLenum magFilter);
+
+	/**
+	 * Frees the layer of a Texture Source.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param source The Texture Source entity.
+	 */
+	void remove (Entity source);
+
+	/**
+	 * Binds the array of a packed Texture Source for the current batch.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param source The Texture Source entity.
+	 * @param batch The counter of the current batch, see
+	 * `Renderer::startActiveTexture`. The arrays bound by previous batches are
+	 * forgotten.
+	 *
+	 * @return The texture id to write in the vertices, or `0` if the array
+	 * units are all used by the current batch.
+	 */
+	int bind (Entity source, int batch);
+
+	/**
+	 * The number of texture units of the arrays. `0` if disabled.
+	 *
+	 * @since 0.0.0
+	 */
+	int units = 0;
+
+	/**
+	 * The texture units of the arrays, used to populate the `uArraySampler`
+	 * uniforms.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> unitIndexes;
+
+private:
+	/**
+	 * A `GL_TEXTURE_2D_ARRAY` holding the Texture Sources of a single size.
+	 *
+	 * @since 0.0.0
+	 */
+	struct TextureArray {
+		GL_texture texture = 0;
+
+		int width = 0;
+
+		int height = 0;
+
+		GLenum minFilter = GL_LINEAR;
+
+		GLenum magFilter = GL_LINEAR;
+
+		/**
+		 * The Texture Source of each layer, `entt::null` if free.
+		 *
+		 * @since 0.0.0
+		 */
+		std::vector<Entity> layers;
+
+		/**
+		 * The texture unit of this array in the current batch, if bound.
+		 *
+		 * @since 0.0.0
+		 */
+		int unit = -1;
+	};
+
+	/**
+	 * Creates the storage of an array for the given number of layers, copying
+	 * the layers of its previous storage, if any.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param array The array to resize.
+	 * @param layers The new number of layers.
+	 */
+	void allocate (TextureArray *array, int layers);
+
+	std::vector<TextureArray> arrays;
+
+	/**
+	 * The array bound to each texture unit in the current batch.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<int> boundArrays;
+
+	/**
+	 * The batch counter of `boundArrays`.
+	 *
+	 * @since 0.0.0
+	 */
+	int batch = -1;
+
+	int firstUnit = 0;
+
+	int maxLayers = MAX_LAYERS;
+
+	int maxSize = 512;
+
+	/**
+	 * The framebuffer reading the layers of an array when it grows.
+	 *
+	 * @since 0.0.0
+	 */
+	GL_fbo copyFramebuffer = 0;
+};
+
+}	// namespace Zen
+
+#endif
@@ -69,6 +69,15 @@ struct PipelineAttribute {
 	 * @since 0.0.0
 	 */
 	int location = -1;
+
+	/**
+	 * The rate at which the attribute advances during instanced rendering, as
+	 * given to `glVertexAttribDivisor`. `0` advances it every vertex, `1` every
+	 * instance.
+	 *
+	 * @since 0.0.0
+	 */
+	GLuint divisor = 0;
 };
 
 }	// namespace Zen
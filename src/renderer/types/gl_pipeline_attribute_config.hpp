@@ -47,6 +47,15 @@ struct PipelineAttributeConfig {
 	 * @since 0.0.0
 	 */
 	bool normalized = false;
+
+	/**
+	 * The rate at which the attribute advances during instanced rendering, as
+	 * given to `glVertexAttribDivisor`. `0` advances it every vertex, `1` every
+	 * instance.
+	 *
+	 * @since 0.0.0
+	 */
+	GLuint divisor = 0;
 };
 
 }	// namespace Zen
@@ -14,6 +14,7 @@
 #include "gl_pipeline_attribute_config.hpp"
 #include "gl_pipeline_shader_config.hpp"
 #include "render_target_config.hpp"
+#include "../../enums/buffer_streaming.hpp"
 
 namespace Zen {
 
@@ -57,6 +58,46 @@ struct PipelineConfig {
 	 */
 	bool forceZero = false;
 
+	/**
+	 * Should quads be batched as 4 indexed vertices instead of 6?
+	 *
+	 * When enabled, the pipeline binds the Renderer's shared quad index buffer
+	 * to its vertex array, `batchQuad` only writes the 4 corners of a quad and
+	 * `flush` draws with `glDrawElements`. Only used with `GL_TRIANGLES`.
+	 *
+	 * @since 0.0.0
+	 */
+	bool indexedQuads = false;
+
+	/**
+	 * Is each entry of the batch a per-instance record of a whole quad?
+	 *
+	 * When enabled, a quad takes a single entry in the vertex buffer, which
+	 * should only hold attributes with a `divisor` of 1, and `flush` draws the
+	 * 6 vertices of every quad with `glDrawArraysInstanced`. The vertex shader
+	 * is responsible for expanding the quad from `gl_VertexID`.
+	 *
+	 * @since 0.0.0
+	 */
+	bool instanced = false;
+
+	/**
+	 * How the vertex buffer is streamed to the GPU on flush.
+	 *
+	 * Ignored if the pipeline uses static `vertices`.
+	 *
+	 * @since 0.0.0
+	 */
+	BUFFER_STREAMING streaming = BUFFER_STREAMING::SUB_DATA;
+
+	/**
+	 * The number of vertex buffers, or buffer regions, cycled through by the
+	 * `ROUND_ROBIN` and `MAP_UNSYNCHRONIZED` streaming modes.
+	 *
+	 * @since 0.0.0
+	 */
+	int streamingBuffers = 3;
+
 	std::vector<RenderTargetConfig> renderTarget;
 };
 
@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_TYPE_GL_UNIFORM_HANDLE_HPP
+#define ZEN_RENDERER_TYPE_GL_UNIFORM_HANDLE_HPP
+
+namespace Zen {
+
+/**
+ * A resolved uniform name, to set uniforms without looking their name up.
+ *
+ * A handle is the same for every shader, whether or not it has the uniform,
+ * so it can be resolved once, with `GetUniformHandle`, and kept around.
+ *
+ * @since 0.0.0
+ */
+struct UniformHandle {
+	/**
+	 * The id of the uniform name, `-1` if invalid.
+	 *
+	 * @since 0.0.0
+	 */
+	int id = -1;
+};
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_RENDERER_UNIFORMS_HPP
+#define ZEN_RENDERER_UNIFORMS_HPP
+
+#include "utility.hpp"
+
+namespace Zen {
+namespace Uniforms {
+
+/**
+ * The projection matrix of the pipelines.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle PROJECTION_MATRIX =
+	GetUniformHandle("uProjectionMatrix");
+
+/**
+ * The main texture sampler, or array of samplers.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle MAIN_SAMPLER = GetUniformHandle("uMainSampler");
+
+/**
+ * The first texture sampler of the blend shaders.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle MAIN_SAMPLER_1 = GetUniformHandle("uMainSampler1");
+
+/**
+ * The second texture sampler of the blend shaders.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle MAIN_SAMPLER_2 = GetUniformHandle("uMainSampler2");
+
+/**
+ * The texture array samplers of the Multi Pipeline, see `TextureArrays`.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle ARRAY_SAMPLER = GetUniformHandle("uArraySampler");
+
+/**
+ * The mask texture sampler of the Bitmap Mask shader.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle MASK_SAMPLER = GetUniformHandle("uMaskSampler");
+
+/**
+ * The resolution of the Bitmap Mask shader.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle RESOLUTION = GetUniformHandle("uResolution");
+
+/**
+ * Whether the Bitmap Mask shader inverts the alpha of the mask.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle INVERT_MASK_ALPHA =
+	GetUniformHandle("uInvertMaskAlpha");
+
+/**
+ * The brightness of the Copy shader.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle BRIGHTNESS = GetUniformHandle("uBrightness");
+
+/**
+ * The strength of the blend shaders.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle STRENGTH = GetUniformHandle("uStrength");
+
+/**
+ * The color matrix of the Color Matrix shader.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle COLOR_MATRIX = GetUniformHandle("uColorMatrix");
+
+/**
+ * The alpha of the Color Matrix shader.
+ *
+ * @since 0.0.0
+ */
+inline const UniformHandle ALPHA = GetUniformHandle("uAlpha");
+
+}	// namespace Uniforms
+}	// namespace Zen
+
+#endif
@@ -8,8 +8,11 @@
 #include "utility.hpp"
 #include <map>
 #include <cstring>
+#include <SDL2/SDL_image.h>
 #include "../utils/string/replace.hpp"
 #include "../utils/assert.hpp"
+#include "../utils/messages.hpp"
+#include "texture_arrays.hpp"
 
 namespace Zen {
 
@@ -332,7 +335,7 @@ std::uint32_t GetTintAppendFloatAlphaAndSwap (int rgb, float a)
 }
 
 std::string ParseFragmentShaderMaxTextures (std::string fragmentShaderSource,
-		size_t maxTextures)
+		size_t maxTextures, size_t maxTextureArrays)
 {
 	if (fragmentShaderSource.empty())
 		return "";
@@ -357,6 +360,44 @@ std::string ParseFragmentShaderMaxTextures (std::string fragmentShaderSource,
 
 	fragmentShaderSource = Replace(fragmentShaderSource, "%forloop%", src);
 
+	std::string arrays;
+	std::string arraySelect;
+
+	if (maxTextureArrays > 0) {
+		std::string layers = std::to_string(TextureArrays::MAX_LAYERS) + ".f";
+
+		arrays = "uniform sampler2DArray uArraySampler[" +
+			std::to_string(maxTextureArrays) + "];\n";
+		arrays += "\nvec4 sampleTextureArray (float id)\n{";
+		arrays += "\n\tvec3 coord = vec3(TexCoord, mod(id, " + layers + "));";
+		arrays += "\n\tfloat unit = floor(id / " + layers + ");\n";
+
+		for (size_t i = 0; i < maxTextureArrays; i++) {
+			std::string sample = "return texture(uArraySampler[" +
+				std::to_string(i) + "], coord);";
+
+			if (i < maxTextureArrays - 1)
+				arrays += "\n\tif (unit < " + std::to_string(i) + ".5f)\n\t\t" +
+					sample;
+			else
+				arrays += "\n\n\t" + sample;
+		}
+
+		arrays += "\n}";
+
+		// Negative ids are texture array layers
+		arraySelect = "if (TexId < -0.5f)";
+		arraySelect += "\n\t{";
+		arraySelect += "\n\t\ttexture = sampleTextureArray(floor(-TexId - 0.5f));";
+		arraySelect += "\n\t}";
+		arraySelect += "\n\telse ";
+	}
+
+	fragmentShaderSource = Replace(fragmentShaderSource, "%arrays%", arrays);
+
+	fragmentShaderSource = Replace(fragmentShaderSource, "%arrayselect%",
+			arraySelect);
+
 	return fragmentShaderSource;
 }
 
@@ -441,4 +482,63 @@ void FlipSurface (SDL_Surface *surface, bool lockSurface)
 		SDL_UnlockSurface(surface);
 }
 
+bool SaveSurface (SDL_Surface *surface, const std::string& path)
+{
+	std::string extension = "";
+
+	// Figure out the file type
+	for (auto c = path.rbegin(); c != path.rend(); c++) {
+		if (*c == '.') {
+			// We read all the extension's characters
+			break;
+		}
+
+		extension.insert(0, 1, *c);
+	}
+
+	if (extension == "bmp") {
+		if (SDL_SaveBMP(surface, path.c_str())) {
+			MessageError("Failed to save snapshot as a 'BMP' file: ",
+					SDL_GetError());
+			return false;
+		}
+	}
+	else if (extension == "png") {
+		if (IMG_SavePNG(surface, path.c_str())) {
+			MessageError("Failed to save snapshot as a 'PNG' file: ",
+					IMG_GetError());
+			return false;
+		}
+	}
+	else if (extension == "jpg" || extension == "jpeg") {
+		if (IMG_SaveJPG(surface, path.c_str(), 100)) {
+			MessageError("Failed to save snapshot as a 'JPG' file: ",
+					IMG_GetError());
+			return false;
+		}
+	}
+	else {
+		MessageError("File type unsupported! Try something else like 'png' "
+				"or 'jpg'.");
+		return false;
+	}
+
+	return true;
+}
+
+UniformHandle GetUniformHandle (const std::string& name)
+{
+	static std::map<std::string, int> handles_;
+
+	auto it_ = handles_.find(name);
+
+	if (it_ != handles_.end())
+		return {it_->second};
+
+	int id_ = handles_.size();
+	handles_.emplace(name, id_);
+
+	return {id_};
+}
+
 }	// namespace Zen
@@ -12,6 +12,7 @@
 #include <array>
 #include <SDL2/SDL.h>
 #include <GL/glew.h>
+#include "types/gl_uniform_handle.hpp"
 
 namespace Zen {
 
@@ -62,8 +63,24 @@ std::uint32_t GetTintAppendFloatAlpha (int rgb, float a);
  */
 std::uint32_t GetTintAppendFloatAlphaAndSwap (int rgb, float a);
 
+/**
+ * Fills the texture selection placeholders of a fragment shader.
+ *
+ * `%count%` and `%forloop%` become the 2D samplers and the branches picking
+ * the one of `TexId`. When texture arrays are used, `%arrays%` becomes their
+ * samplers and the function sampling a layer, and `%arrayselect%` the branch
+ * calling it for negative texture ids. Otherwise they are removed.
+ *
+ * @since 0.0.0
+ *
+ * @param fragmentShaderSource The fragment shader source.
+ * @param maxTextures The number of 2D texture units.
+ * @param maxTextureArrays The number of texture array units.
+ *
+ * @return The parsed fragment shader source.
+ */
 std::string ParseFragmentShaderMaxTextures (std::string fragmentShaderSource,
-		size_t maxTextures);
+		size_t maxTextures, size_t maxTextureArrays = 0);
 
 std::array<GLenum, 2> GetTexGLFormatFromSDLFormat (SDL_Surface *surface, bool gamma = false);
 
@@ -79,6 +96,36 @@ std::array<GLenum, 2> GetTexGLFormatFromSDLFormat (SDL_Surface *surface, bool ga
  */
 void FlipSurface (SDL_Surface *surface, bool lockSurface = true);
 
+/**
+ * Saves a surface in an image file. The type of the file is given by the
+ * extension of the path: `png`, `bmp`, `jpg` or `jpeg`.
+ *
+ * It doesn't touch any OpenGL state, so it can run on a worker thread.
+ *
+ * @since 0.0.0
+ *
+ * @param surface The surface to save.
+ * @param path The path of the file.
+ *
+ * @return `true` if the file was saved.
+ */
+bool SaveSurface (SDL_Surface *surface, const std::string& path);
+
+/**
+ * Resolves a uniform name to a handle that can be used to set it on any shader
+ * without looking the name up.
+ *
+ * The same name always resolves to the same handle. Indexed names, like
+ * `uName[3]`, are not supported.
+ *
+ * @since 0.0.0
+ *
+ * @param name The name of the uniform.
+ *
+ * @return The handle of the uniform.
+ */
+UniformHandle GetUniformHandle (const std::string& name);
+
 }	// namespace Zen
 
 #endif
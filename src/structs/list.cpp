@@ -24,6 +24,7 @@ void List<T>::add (T item_, bool skipCallback_)
 		return;
 
 	list.emplace_back(item_);
+	version++;
 
 	if (!skipCallback_ && addCallback)
 		addCallback(item_);
@@ -33,6 +34,7 @@ template <typename T>
 void List<T>::addAt (T item_, std::size_t index_, bool skipCallback_)
 {
 	list.emplace(list.begin() + index_, item_);
+	version++;
 
 	if (!skipCallback_ && addCallback)
 		addCallback(item_);
@@ -57,6 +59,8 @@ void List<T>::sort (std::function<bool(T, T)> handler_)
 		std::stable_sort(list.begin(), list.end(), handler_);
 	else if (sortCallback != nullptr)
 		std::stable_sort(list.begin(), list.end(), sortCallback);
+
+	version++;
 }
 
 template <typename T>
@@ -72,6 +76,7 @@ void List<T>::swap (std::size_t index1_, std::size_t index2_)
 	auto it2_ = list.begin() + index2_;
 
 	std::iter_swap(it1_, it2_);
+	version++;
 }
 
 template <typename T>
@@ -81,6 +86,7 @@ void List<T>::swap (T item1_, T item2_)
 	auto it2_ = std::find(list.begin(), list.end(), item2_);
 
 	std::iter_swap(it1_, it2_);
+	version++;
 }
 
 template <typename T>
@@ -88,12 +94,14 @@ void List<T>::moveTo (T item_, std::size_t index_)
 {
 	Remove(list, item_);
 	list.emplace(list.begin() + index_, item_);
+	version++;
 }
 
 template <typename T>
 void List<T>::remove (T item_, bool skipCallback_)
 {
 	Remove(list, item_);
+	version++;
 
 	if (!skipCallback_ && removeCallback)
 		removeCallback(item_);
@@ -111,6 +119,7 @@ void List<T>::removeAt (std::size_t index_, bool skipCallback_)
 {
 	T item_ = list.at(index_);
 	Remove(list, item_);
+	version++;
 
 	if (!skipCallback_ && removeCallback)
 		removeCallback(item_);
@@ -126,6 +135,7 @@ void List<T>::removeBetween (std::size_t start_, std::size_t end_, bool skipCall
 		items_[i_] = list[i_];
 
 	list.erase(list.begin() + start_, list.begin() + end_);
+	version++;
 
 	if (!skipCallback_ && removeCallback)
 	{
@@ -162,7 +172,10 @@ void List<T>::moveUp (T item_)
 	auto idx_ = IndexOf(list, item_);
 
 	if (idx_ >= 0 && idx_ < (int)(list.size() - 1))
+	{
 		std::iter_swap(list.begin() + idx_, list.begin() + idx_ + 1);
+		version++;
+	}
 }
 
 template <typename T>
@@ -171,26 +184,34 @@ void List<T>::moveDown (T item_)
 	auto idx_ = IndexOf(list, item_);
 
 	if (idx_ > 0)
+	{
 		std::iter_swap(list.begin() + idx_, list.begin() + idx_ - 1);
+		version++;
+	}
 }
 
 template <typename T>
 void List<T>::reverse ()
 {
 	std::reverse(list.begin(), list.end());
+	version++;
 }
 
 template <typename T>
 void List<T>::shuffle ()
 {
 	Math::Random.shuffle(&list);
+	version++;
 }
 
 template <typename T>
 void List<T>::replace (T oldItem_, T newItem_)
 {
 	if (!exists(newItem_))
+	{
 		std::replace(list.begin(), list.end(), oldItem_, newItem_);
+		version++;
+	}
 }
 
 template <typename T>
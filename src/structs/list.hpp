@@ -52,6 +52,14 @@ public:
 	 */
 	bool unique = false;
 
+	/**
+	 * Incremented whenever items are added, removed or moved, so data derived
+	 * from the order of the items can be cached.
+	 *
+	 * @since 0.0.0
+	 */
+	std::size_t version = 0;
+
 	/**
 	 * Adds the given item to the end of this vector. Each item is unique.
 	 *
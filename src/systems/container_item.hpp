@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_CONTAINERITEM_HPP
+#define ZEN_SYSTEMS_CONTAINERITEM_HPP
+
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Moves a Game Object into a container, such as a Render Texture cached as
+ * bitmap.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ * @param parent The container, or `entt::null` to remove the Game Object
+ * from its container.
+ */
+void SetParent (Entity entity, Entity parent);
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ *
+ * @return The container of the Game Object, or `entt::null` if it has none.
+ */
+Entity GetParent (Entity entity);
+
+}	// namespace Zen
+
+#endif
@@ -16,6 +16,20 @@ bool IsDirty (Entity entity);
 
 void SetDirty (Entity entity, bool value);
 
+/**
+ * Flags the entity as dirty, if it has a 'Dirty' component.
+ *
+ * This is called by the setters of everything a sprite's vertices are
+ * generated from, to invalidate its vertex cache. It also flags the
+ * containers of the entity that are cached as bitmap, so call it after any
+ * other change to a child of a cached container.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The entity to flag.
+ */
+void MarkDirty (Entity entity);
+
 }	// namespace Zen
 
 #endif
@@ -8,6 +8,7 @@
 #ifndef ZEN_SYSTEMS_MASK_HPP
 #define ZEN_SYSTEMS_MASK_HPP
 
+#include <array>
 #include "../ecs/entity.hpp"
 
 namespace Zen {
@@ -61,12 +62,37 @@ void DeleteMask (Entity entity);
 ///////////
 // Geometry
 ///////////
-void SetShape (Entity mask, Entity graphicsGeometry);
+/**
+ * Makes a mask a geometry mask, using the shape of the given entity.
+ *
+ * @since 0.0.0
+ *
+ * @param mask The mask entity.
+ * @param shape The renderable entity to draw into the stencil buffer.
+ */
+void SetShape (Entity mask, Entity shape);
 void SetInvertAlpha (Entity mask, bool value);
 void PreRender (Entity mask, Entity child, Entity camera);
 void ApplyStencil (Entity mask, Entity camera, bool inc);
 void PostRender (Entity mask);
 
+/**
+ * Computes the scissor rectangle a geometry mask can be replaced with.
+ *
+ * This is only possible when the shape of the mask is an uncropped image
+ * whose corners stay axis-aligned once transformed by the camera, so neither
+ * the image nor the camera are rotated. The stencil buffer then isn't needed.
+ *
+ * @since 0.0.0
+ *
+ * @param mask The mask entity.
+ * @param camera The camera rendering the masked Game Object.
+ * @param scissor The rectangle, in window coordinates, to store the result in.
+ *
+ * @return `true` if the mask can use the scissor.
+ */
+bool GetMaskScissor (Entity mask, Entity camera, std::array<int, 4> *scissor);
+
 // TODO
 void PreRenderMask (Entity mask, Entity camera);
 void PostRenderMask (Entity mask, Entity camera);
@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_OPAQUE_HPP
+#define ZEN_SYSTEMS_OPAQUE_HPP
+
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Tells the Renderer that the texture of a Game Object has no transparent
+ * pixel.
+ *
+ * When the `opaquePass` option is set, opaque Game Objects are drawn first,
+ * front to back, with depth writes, so the pixels they hide are never shaded.
+ * A Game Object is only drawn as opaque while it is fully visible, uses the
+ * default blend mode, and has no mask or post pipeline.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ * @param value `true` if the Game Object is opaque.
+ */
+void SetOpaque (Entity entity, bool value = true);
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ *
+ * @return `true` if the Game Object is set as opaque.
+ */
+bool IsOpaque (Entity entity);
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_RENDERTEXTURE_HPP
+#define ZEN_SYSTEMS_RENDERTEXTURE_HPP
+
+#include <span>
+#include <string>
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Creates the texture, framebuffer and camera of a Render Texture Game
+ * Object, and adds the texture to the Texture Manager.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object, with a `RenderTexture` component.
+ * @param width The width of the texture.
+ * @param height The height of the texture.
+ * @param key The key of the texture in the Texture Manager. A unique one is
+ * generated if empty.
+ *
+ * @return The key of the texture, or an empty string if it couldn't be
+ * created.
+ */
+std::string InitRenderTexture (Entity entity, int width, int height,
+		std::string key = "");
+
+/**
+ * Deletes the framebuffer and the camera of a Render Texture, and removes
+ * its texture from the Texture Manager.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ */
+void DestroyRenderTexture (Entity entity);
+
+/**
+ * Clears a Render Texture to transparent.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ */
+void ClearRenderTexture (Entity entity);
+
+/**
+ * Draws Game Objects into a Render Texture, on top of its content.
+ *
+ * Their positions are relative to the top left corner of the texture. Their
+ * masks are ignored.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ * @param entities The Game Objects, in drawing order.
+ */
+void DrawRenderTexture (Entity entity, std::span<const Entity> entities);
+
+/**
+ * Caches the children of a Render Texture as a bitmap.
+ *
+ * The Game Objects whose parent is the Render Texture, see `SetParent`, are
+ * drawn into it the first time it is rendered, then the Render Texture is
+ * drawn as a single quad and the children are skipped by the cameras. They
+ * are only drawn again once one of them is flagged with `MarkDirty`, which the
+ * setters do. This makes a static interface made of many Game Objects cost a
+ * single draw per frame.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ * @param value `false` to render the children on their own again.
+ */
+void SetCacheAsBitmap (Entity entity, bool value = true);
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ *
+ * @return `true` if the Game Object caches its children as a bitmap.
+ */
+bool IsCachedAsBitmap (Entity entity);
+
+/**
+ * Gets the closest container of a Game Object that is cached as bitmap.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Game Object.
+ *
+ * @return The container drawing the Game Object, or `entt::null` if the
+ * Game Object is rendered on its own.
+ */
+Entity GetCachedContainer (Entity entity);
+
+/**
+ * Draws the children of a Render Texture cached as bitmap again, if one of
+ * them was flagged as dirty.
+ *
+ * This is called when the Render Texture is rendered.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The Render Texture.
+ */
+void UpdateCacheAsBitmap (Entity entity);
+
+}	// namespace Zen
+
+#endif
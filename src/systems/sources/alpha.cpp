@@ -7,6 +7,7 @@
 
 #include "../alpha.hpp"
 
+#include "../dirty.hpp"
 #include "../../math/clamp.hpp"
 #include "../../utils/assert.hpp"
 
@@ -44,6 +45,8 @@ void SetAlpha (Entity entity, double topLeft, double topRight, double bottomLeft
 			// Turn the alpha bit to 1
 			renderable->flags |= FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 double GetAlpha (Entity entity)
@@ -119,6 +122,8 @@ void SetAlpha (Entity entity, double value)
 			// Turn the alpha bit to 1
 			renderable->flags |= FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaTopLeft (Entity entity, double value)
@@ -136,6 +141,8 @@ void SetAlphaTopLeft (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaTopRight (Entity entity, double value)
@@ -153,6 +160,8 @@ void SetAlphaTopRight (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaBottomLeft (Entity entity, double value)
@@ -170,6 +179,8 @@ void SetAlphaBottomLeft (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetAlphaBottomRight (Entity entity, double value)
@@ -187,6 +198,8 @@ void SetAlphaBottomRight (Entity entity, double value)
 			// Turn the alpha bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../container_item.hpp"
+
+#include "../dirty.hpp"
+#include "../../components/container_item.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+void SetParent (Entity entity, Entity parent)
+{
+	// Both the previous and the new cached containers must be drawn again
+	MarkDirty(entity);
+
+	if (parent == entt::null)
+		g_registry.remove_if_exists<Components::ContainerItem>(entity);
+	else
+		g_registry.emplace_or_replace<Components::ContainerItem>(entity, parent);
+
+	MarkDirty(entity);
+}
+
+Entity GetParent (Entity entity)
+{
+	auto item = g_registry.try_get<Components::ContainerItem>(entity);
+
+	return (item) ? item->parent : entt::null;
+}
+
+}	// namespace Zen
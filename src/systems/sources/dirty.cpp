@@ -9,6 +9,10 @@
 
 #include "../../utils/assert.hpp"
 #include "../../components/dirty.hpp"
+#include "../../components/container_item.hpp"
+#include "../../components/cache_as_bitmap.hpp"
+#include "../../components/spatial.hpp"
+#include "../../gameobjects/spatial_index.hpp"
 
 namespace Zen {
 
@@ -30,4 +34,32 @@ void SetDirty (Entity entity, bool value)
 	dirty->value = value;
 }
 
+void MarkDirty (Entity entity)
+{
+	auto dirty = g_registry.try_get<Components::Dirty>(entity);
+
+	if (dirty)
+		dirty->value = true;
+
+	// Its world bounds have to be computed again before culling
+	auto spatial = g_registry.try_get<Components::Spatial>(entity);
+
+	if (spatial && !spatial->dirty) {
+		spatial->dirty = true;
+		spatial->index->markDirty(entity);
+	}
+
+	// The containers cached as bitmap, up to the outermost one, have to draw
+	// their children again
+	auto item = g_registry.try_get<Components::ContainerItem>(entity);
+
+	while (item) {
+		if (auto cache = g_registry.try_get<Components::CacheAsBitmap>(
+					item->parent))
+			cache->dirty = true;
+
+		item = g_registry.try_get<Components::ContainerItem>(item->parent);
+	}
+}
+
 }	// namespace Zen
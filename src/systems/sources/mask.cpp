@@ -7,21 +7,38 @@
 
 #include "../mask.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include "../../components/mask.hpp"
 #include "../../components/masked.hpp"
 #include "../../components/renderable.hpp"
 #include "../../components/actor.hpp"
 #include "../../components/textured.hpp"
+#include "../../components/text.hpp"
+#include "../../texture/components/frame.hpp"
 #include "../../utils/assert.hpp"
 #include "../../scene/scene.hpp"
 #include "../../renderer/renderer.hpp"
 #include "../../renderer/events/events.hpp"
+#include "../../scale/scale_manager.hpp"
+#include "../../window/window.hpp"
 #include "../renderable.hpp"
+#include "../textured.hpp"
+#include "../flip.hpp"
+#include "../origin.hpp"
+#include "../position.hpp"
+#include "../rotation.hpp"
+#include "../scale.hpp"
+#include "../scroll.hpp"
+#include "../scroll_factor.hpp"
+#include "../transform_matrix.hpp"
 
 namespace Zen {
 
 extern entt::registry g_registry;
 extern Renderer g_renderer;
+extern ScaleManager g_scale;
+extern Window g_window;
 
 Entity GetMask (Entity entity)
 {
@@ -45,17 +62,39 @@ void SetMask (Entity entity, Entity maskEntity)
 	masked.mask = maskEntity;
 	masked.camera = actor->scene->cameras.main;
 
-	// Is the mask entity already setup?
-	if (!g_registry.has<Components::Mask>(maskEntity)) {
-		g_registry.emplace_or_replace<Components::Mask>(maskEntity);
+	// Is the mask entity already setup? The factory gives a blank 'Mask'
+	// component to the images
+	auto *current = g_registry.try_get<Components::Mask>(maskEntity);
+
+	if (!current || current->maskEntity == entt::null) {
+		auto &mask = g_registry.emplace_or_replace<Components::Mask>(maskEntity);
+		mask.maskEntity = maskEntity;
 
 		// Is the mask entity a bitmap object?
 		if (g_registry.try_get<Components::Textured>(maskEntity)) {
 			MakeMaskBitmap(maskEntity);
 		}
+		else {
+			mask.isBitmap = false;
+			mask.isStencil = true;
+		}
 	}
 }
 
+void SetShape (Entity mask, Entity shape)
+{
+	// Free the framebuffers of a bitmap mask
+	auto *previous = g_registry.try_get<Components::Mask>(mask);
+	if (previous && previous->mainTexture)
+		DeleteMask(mask);
+
+	auto &m = g_registry.emplace_or_replace<Components::Mask>(mask);
+
+	m.isBitmap = false;
+	m.isStencil = true;
+	m.maskEntity = shape;
+}
+
 void MakeMaskBitmap (Entity entity)
 {
 	auto *mask = g_registry.try_get<Components::Mask>(entity);
@@ -123,13 +162,45 @@ void PreRenderMask (Entity masked, Entity camera)
 	if (m->isBitmap) {
 		g_renderer.pipelines.BITMAPMASK_PIPELINE->beginMask(md->mask, camera);
 	}
+	else if (std::array<int, 4> rect; !m->invertAlpha
+			&& GetMaskScissor(md->mask, camera, &rect)) {
+		// An axis-aligned rectangle only needs the scissor, which is
+		// intersected with the current one so the camera viewport still clips
+		auto current = g_renderer.currentScissor;
+
+		if (current[2] > 0) {
+			int left = std::max(rect[0], current[0]);
+			int top = std::max(rect[1], current[1]);
+			int right = std::min(rect[0] + rect[2], current[0] + current[2]);
+			int bottom = std::min(rect[1] + rect[3], current[1] + current[3]);
+
+			rect = {left, top, std::max(right - left, 0),
+				std::max(bottom - top, 0)};
+		}
+
+		g_renderer.flush(FLUSH_REASON::MASK);
+
+		g_renderer.state.enable(GL_SCISSOR_TEST);
+		g_renderer.pushScissor(rect[0], rect[1], rect[2], rect[3]);
+
+		// An empty scissor isn't applied by the renderer, but here it must
+		// hide everything
+		if (rect[2] <= 0 || rect[3] <= 0)
+			g_renderer.state.scissor(0, 0, 0, 0);
+
+		g_renderer.stats.scissorMasks++;
+
+		m->scissor = true;
+	}
 	else {
+		m->scissor = false;
+
 		// Force flushing before drawing to stencil buffer
-		g_renderer.flush();
+		g_renderer.flush(FLUSH_REASON::MASK);
 
 		if (g_renderer.maskStack.empty()) {
-			glEnable(GL_STENCIL_TEST);
-			glClear(GL_STENCIL_BUFFER_BIT);
+			g_renderer.state.enable(GL_STENCIL_TEST);
+			g_renderer.clear(GL_STENCIL_BUFFER_BIT);
 
 			g_renderer.maskCount = 0;
 		}
@@ -138,6 +209,7 @@ void PreRenderMask (Entity masked, Entity camera)
 			g_renderer.currentMask.mask = md->mask;
 
 		g_renderer.maskStack.push_back({.mask = md->mask, .camera = camera});
+		g_renderer.stats.stencilPushes++;
 
 		ApplyStencil(md->mask, camera, true);
 
@@ -152,36 +224,44 @@ void ApplyStencil (Entity maskEntity, Entity camera, bool inc)
 
 	int level = g_renderer.maskCount;
 
-	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+	g_renderer.state.colorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 
 	if (inc) {
-		glStencilFunc(GL_EQUAL, level, 0xFF);
-		glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+		g_renderer.state.stencilFunc(GL_EQUAL, level, 0xFF);
+		g_renderer.state.stencilOp(GL_KEEP, GL_KEEP, GL_INCR);
 	}
 	else  {
-		glStencilFunc(GL_EQUAL, level + 1, 0xFF);
-		glStencilOp(GL_KEEP, GL_KEEP, GL_DECR);
+		g_renderer.state.stencilFunc(GL_EQUAL, level + 1, 0xFF);
+		g_renderer.state.stencilOp(GL_KEEP, GL_KEEP, GL_DECR);
 	}
 
+	// The opaque Game Objects mustn't hide the shape of the mask, only what
+	// it masks
+	if (g_renderer.opaquePass)
+		g_renderer.state.disable(GL_DEPTH_TEST);
+
 	// Write stencil buffer
 	Render(mask->maskEntity, camera);
 
-	g_renderer.flush();
+	g_renderer.flush(FLUSH_REASON::MASK);
+
+	if (g_renderer.opaquePass)
+		g_renderer.state.enable(GL_DEPTH_TEST);
 
-	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-	glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+	g_renderer.state.colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+	g_renderer.state.stencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
 
 	if (inc) {
 		if (mask->invertAlpha)
-			glStencilFunc(GL_NOTEQUAL, level + 1, 0xFF);
+			g_renderer.state.stencilFunc(GL_NOTEQUAL, level + 1, 0xFF);
 		else
-			glStencilFunc(GL_EQUAL, level + 1, 0xFF);
+			g_renderer.state.stencilFunc(GL_EQUAL, level + 1, 0xFF);
 	}
 	else if (mask->invertAlpha) {
-		glStencilFunc(GL_NOTEQUAL, level, 0xFF);
+		g_renderer.state.stencilFunc(GL_NOTEQUAL, level, 0xFF);
 	}
 	else {
-		glStencilFunc(GL_EQUAL, level, 0xFF);
+		g_renderer.state.stencilFunc(GL_EQUAL, level, 0xFF);
 	}
 }
 
@@ -193,18 +273,30 @@ void PostRenderMask (Entity mask, Entity camera)
 	if (m->isBitmap) {
 		g_renderer.pipelines.BITMAPMASK_PIPELINE->endMask(mask, camera);
 	}
+	else if (m->scissor) {
+		g_renderer.flush(FLUSH_REASON::MASK);
+
+		g_renderer.popScissor();
+
+		// Without a camera scissor left, the whole window is drawable again
+		if (g_renderer.scissorStack.empty())
+			g_renderer.state.scissor(0, 0, g_window.width(), g_window.height());
+
+		m->scissor = false;
+	}
 	else {
 		g_renderer.maskStack.pop_back();
 		g_renderer.maskCount--;
+		g_renderer.stats.stencilPops++;
 
 		// Force flush before disabling stencil test
-		g_renderer.flush();
+		g_renderer.flush(FLUSH_REASON::MASK);
 
 		if (g_renderer.maskStack.empty()) {
 			// If this is the only mask in the stack, flush and disable
 			g_renderer.currentMask = {entt::null, entt::null};
 
-			glDisable(GL_STENCIL_TEST);
+			g_renderer.state.disable(GL_STENCIL_TEST);
 		}
 		else {
 			Mask_ &prev = g_renderer.maskStack.back();
@@ -222,6 +314,74 @@ void PostRenderMask (Entity mask, Entity camera)
 	}
 }
 
+bool GetMaskScissor (Entity mask, Entity camera, std::array<int, 4> *scissor)
+{
+	auto m = g_registry.try_get<Components::Mask>(mask);
+	ZEN_ASSERT(m, "The entity has no 'Mask' component.");
+
+	Entity shape = m->maskEntity;
+
+	// Only an image fills its whole quad in the stencil buffer
+	if (shape == entt::null || !g_registry.has<Components::Textured>(shape)
+			|| g_registry.has<Components::Text>(shape) || IsCropped(shape))
+		return false;
+
+	// Same matrices as the multi pipeline, see `MultiPipeline::prepareSprite`
+	auto *frame = g_registry.try_get<Components::Frame>(GetFrame(shape));
+	if (!frame)
+		return false;
+
+	Components::TransformMatrix spriteMatrix;
+	ApplyITRS(&spriteMatrix, GetX(shape), GetY(shape), GetRotation(shape),
+			GetScaleX(shape), GetScaleY(shape));
+
+	spriteMatrix.e -= GetScrollX(camera) * GetScrollFactorX(shape);
+	spriteMatrix.f -= GetScrollY(camera) * GetScrollFactorY(shape);
+
+	Components::TransformMatrix calcMatrix = GetTransformMatrix(camera);
+	Multiply(&calcMatrix, spriteMatrix);
+
+	// Any rotation left, from the image or the camera, needs the stencil
+	const double epsilon = 1e-6;
+	if (std::abs(calcMatrix.b) > epsilon || std::abs(calcMatrix.c) > epsilon)
+		return false;
+
+	// The flip mirrors the quad around its origin, it covers the same area
+	double x = -GetDisplayOriginX(shape) + frame->data.spriteSourceSize.x;
+	double y = -GetDisplayOriginY(shape) + frame->data.spriteSourceSize.y;
+
+	if (GetFlipX(shape) && !frame->customPivot)
+		x += -frame->data.sourceSize.width + GetDisplayOriginX(shape) * 2;
+	if (GetFlipY(shape) && !frame->customPivot)
+		y += -frame->data.sourceSize.height + GetDisplayOriginY(shape) * 2;
+
+	double x0 = calcMatrix.a * x + calcMatrix.e;
+	double y0 = calcMatrix.d * y + calcMatrix.f;
+	double x1 = calcMatrix.a * (x + frame->cutWidth) + calcMatrix.e;
+	double y1 = calcMatrix.d * (y + frame->cutHeight) + calcMatrix.f;
+
+	if (x0 > x1)
+		std::swap(x0, x1);
+	if (y0 > y1)
+		std::swap(y0, y1);
+
+	// To window coordinates, like the camera viewport
+	x0 = x0 * g_scale.displayScale.x + g_scale.displayOffset.x;
+	x1 = x1 * g_scale.displayScale.x + g_scale.displayOffset.x;
+	y0 = y0 * g_scale.displayScale.y + g_scale.displayOffset.y;
+	y1 = y1 * g_scale.displayScale.y + g_scale.displayOffset.y;
+
+	// Keep the pixels whose center is inside the quad, as the rasterizer does
+	int left = std::ceil(x0 - .5);
+	int top = std::ceil(y0 - .5);
+	int right = std::ceil(x1 - .5);
+	int bottom = std::ceil(y1 - .5);
+
+	*scissor = {left, top, right - left, bottom - top};
+
+	return true;
+}
+
 bool IsMaskStencil (Entity entity)
 {
 	auto mask = g_registry.try_get<Components::Mask>(entity);
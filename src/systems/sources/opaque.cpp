@@ -0,0 +1,29 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../opaque.hpp"
+
+#include "../../components/opaque.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+void SetOpaque (Entity entity, bool value)
+{
+	if (value)
+		g_registry.emplace_or_replace<Components::Opaque>(entity);
+	else
+		g_registry.remove_if_exists<Components::Opaque>(entity);
+}
+
+bool IsOpaque (Entity entity)
+{
+	return g_registry.has<Components::Opaque>(entity);
+}
+
+}	// namespace Zen
@@ -7,6 +7,7 @@
 
 #include "../origin.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 
 #include "../../components/size.hpp"
@@ -26,6 +27,8 @@ void SetDisplayOriginX (Entity entity, int value)
 
 	origin->displayX = value;
 	origin->x = value / size->width;
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOriginY (Entity entity, int value)
@@ -35,6 +38,8 @@ void SetDisplayOriginY (Entity entity, int value)
 
 	origin->displayY = value;
 	origin->y = value / size->height;
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOrigin (Entity entity, int x, int y)
@@ -46,6 +51,8 @@ void SetDisplayOrigin (Entity entity, int x, int y)
 	origin->displayY = y;
 	origin->x = x / size->width;
 	origin->y = y / size->height;
+
+	MarkDirty(entity);
 }
 
 void SetDisplayOrigin (Entity entity, int value = 0)
@@ -67,6 +74,8 @@ void SetOrigin (Entity entity, double x, double y)
 		origin->displayX = origin->x * size->width;
 		origin->displayY = origin->y * size->height;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetOrigin (Entity entity, double value)
@@ -96,6 +105,8 @@ void SetOriginFromFrame (Entity entity)
 	// Update display origin
 	origin->displayX = origin->x * size->width;
 	origin->displayY = origin->y * size->height;
+
+	MarkDirty(entity);
 }
 
 double GetOriginX (Entity entity)
@@ -138,6 +149,8 @@ void UpdateDisplayOrigin (Entity entity)
 	// Update display origin
 	origin->displayX = origin->x * size->width;
 	origin->displayY = origin->y * size->height;
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
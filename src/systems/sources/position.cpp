@@ -7,6 +7,7 @@
 
 #include "../position.hpp"
 
+#include "../dirty.hpp"
 #include "../../components/position.hpp"
 #include "../../components/update.hpp"
 #include "../../components/size.hpp"
@@ -28,6 +29,8 @@ void SetPosition (Entity entity, double x, double y, double z, double w)
 	position->y = y;
 	position->z = z;
 	position->w = w;
+
+	MarkDirty(entity);
 }
 
 void SetPosition (Entity entity, Math::Vector2 source)
@@ -62,6 +65,8 @@ void SetRandomPosition (Entity entity, double x, double y, double width, double
 
 	position->x = Math::Random.between(x, width);
 	position->y = Math::Random.between(y, height);
+
+	MarkDirty(entity);
 }
 
 void SetX (Entity entity, double value)
@@ -73,6 +78,8 @@ void SetX (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetY (Entity entity, double value)
@@ -84,6 +91,8 @@ void SetY (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetZ (Entity entity, double value)
@@ -0,0 +1,194 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../render_texture.hpp"
+
+#include <algorithm>
+#include <vector>
+#include "../../components/render_texture.hpp"
+#include "../../components/cache_as_bitmap.hpp"
+#include "../../components/container_item.hpp"
+#include "../../components/actor.hpp"
+#include "../../texture/components/source.hpp"
+#include "../../texture/components/texture.hpp"
+#include "../../texture/systems/source.hpp"
+#include "../../texture/systems/texture.hpp"
+#include "../../texture/texture_manager.hpp"
+#include "../../cameras/2d/systems/camera.hpp"
+#include "../../utils/assert.hpp"
+#include "../../scene/scene.hpp"
+#include "../../renderer/renderer.hpp"
+#include "../renderable.hpp"
+#include "../blend_mode.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+extern Renderer g_renderer;
+extern TextureManager g_texture;
+
+// Used to generate the missing texture keys
+static int renderTextureCount = 0;
+
+std::string InitRenderTexture (Entity entity, int width, int height,
+		std::string key)
+{
+	while (key.empty() || g_texture.exists(key))
+		key = "__RENDERTEXTURE" + std::to_string(renderTextureCount++);
+
+	auto &rt = g_registry.emplace_or_replace<Components::RenderTexture>(entity);
+	rt.width = std::max(width, 1);
+	rt.height = std::max(height, 1);
+
+	if (g_texture.addRenderTexture(key, entity) == entt::null)
+		return "";
+
+	auto &source = g_registry.get<Components::TextureSource>(rt.source);
+
+	rt.framebuffer = g_renderer.createFramebuffer(rt.width, rt.height,
+			source.glTexture, false);
+
+	rt.camera = CreateCamera(0, 0, rt.width, rt.height);
+
+	ClearRenderTexture(entity);
+
+	return key;
+}
+
+void DestroyRenderTexture (Entity entity)
+{
+	auto rt = g_registry.try_get<Components::RenderTexture>(entity);
+	ZEN_ASSERT(rt, "The entity has no 'RenderTexture' component.");
+
+	g_renderer.deleteFramebuffer(rt->framebuffer);
+
+	if (rt->camera != entt::null)
+		DestroyCamera(rt->camera);
+
+	if (rt->source != entt::null) {
+		Entity texture = g_registry.get<Components::TextureSource>(
+				rt->source).texture;
+
+		g_texture.remove(g_registry.get<Components::Texture>(texture).key);
+
+		DestroyTextureSource(rt->source);
+		DestroyTexture(texture);
+	}
+
+	g_registry.remove<Components::RenderTexture>(entity);
+	g_registry.remove_if_exists<Components::CacheAsBitmap>(entity);
+}
+
+void ClearRenderTexture (Entity entity)
+{
+	auto rt = g_registry.try_get<Components::RenderTexture>(entity);
+	ZEN_ASSERT(rt, "The entity has no 'RenderTexture' component.");
+
+	if (!rt->framebuffer)
+		return;
+
+	g_renderer.pushRenderTexture(rt->framebuffer, rt->width, rt->height);
+
+	g_renderer.state.clearColor(0.f, 0.f, 0.f, 0.f);
+	g_renderer.clear(GL_COLOR_BUFFER_BIT);
+
+	g_renderer.popRenderTexture();
+}
+
+void DrawRenderTexture (Entity entity, std::span<const Entity> entities)
+{
+	auto rt = g_registry.try_get<Components::RenderTexture>(entity);
+	ZEN_ASSERT(rt, "The entity has no 'RenderTexture' component.");
+
+	if (!rt->framebuffer)
+		return;
+
+	Entity camera = rt->camera;
+
+	g_renderer.pushRenderTexture(rt->framebuffer, rt->width, rt->height);
+
+	// Updates the matrix of the camera and clears its render list
+	PreRender(camera);
+
+	int blendMode = g_renderer.currentBlendMode;
+
+	for (auto child : entities) {
+		if (!WillRender(child, camera))
+			continue;
+
+		int bm = GetBlendMode(child);
+		if (bm != g_renderer.currentBlendMode)
+			g_renderer.setBlendMode(bm);
+
+		Render(child, camera);
+	}
+
+	if (blendMode != g_renderer.currentBlendMode)
+		g_renderer.setBlendMode(blendMode);
+
+	g_renderer.popRenderTexture();
+}
+
+void SetCacheAsBitmap (Entity entity, bool value)
+{
+	if (value) {
+		ZEN_ASSERT(g_registry.has<Components::RenderTexture>(entity),
+				"The entity has no 'RenderTexture' component.");
+
+		g_registry.emplace_or_replace<Components::CacheAsBitmap>(entity);
+	}
+	else {
+		g_registry.remove_if_exists<Components::CacheAsBitmap>(entity);
+	}
+}
+
+bool IsCachedAsBitmap (Entity entity)
+{
+	return g_registry.has<Components::CacheAsBitmap>(entity);
+}
+
+Entity GetCachedContainer (Entity entity)
+{
+	auto item = g_registry.try_get<Components::ContainerItem>(entity);
+
+	while (item) {
+		if (g_registry.has<Components::CacheAsBitmap>(item->parent))
+			return item->parent;
+
+		item = g_registry.try_get<Components::ContainerItem>(item->parent);
+	}
+
+	return entt::null;
+}
+
+void UpdateCacheAsBitmap (Entity entity)
+{
+	auto [cache, actor] = g_registry.try_get<Components::CacheAsBitmap,
+		 Components::Actor>(entity);
+
+	if (!cache || !cache->dirty)
+		return;
+
+	// Not shared, as the children may be cached containers themselves
+	std::vector<Entity> children;
+
+	if (actor && actor->scene) {
+		for (auto child : actor->scene->children.getChildren()) {
+			if (GetCachedContainer(child) == entity)
+				children.push_back(child);
+		}
+	}
+
+	ClearRenderTexture(entity);
+	DrawRenderTexture(entity, children);
+
+	cache->dirty = false;
+
+	g_renderer.stats.bitmapCacheUpdates++;
+}
+
+}	// namespace Zen
@@ -7,13 +7,13 @@
 
 #include "../rotation.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../math/const.hpp"
 #include "../../math/angle/wrap_degrees.hpp"
 #include "../../math/angle/wrap_radians.hpp"
 #include "../../components/rotation.hpp"
 #include "../../components/container_item.hpp"
-#include "../../components/dirty.hpp"
 
 namespace Zen {
 
@@ -21,13 +21,12 @@ extern entt::registry g_registry;
 
 void SetAngle (Entity entity, double value)
 {
-	auto [rotation, dirty] = g_registry.try_get<Components::Rotation, Components::Dirty>(entity);
+	auto rotation = g_registry.try_get<Components::Rotation>(entity);
 	ZEN_ASSERT(rotation, "The entity has no 'Rotation' component.");
 
 	rotation->value = Math::WrapDegrees(value * Math::DEG_TO_RAD);
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 double GetAngle (Entity entity)
@@ -40,13 +39,12 @@ double GetAngle (Entity entity)
 
 void SetRotation (Entity entity, double value)
 {
-	auto [rotation, dirty] = g_registry.try_get<Components::Rotation, Components::Dirty>(entity);
+	auto rotation = g_registry.try_get<Components::Rotation>(entity);
 	ZEN_ASSERT(rotation, "The entity has no 'Rotation' component.");
 
 	rotation->value = Math::WrapRadians(value);
 
-	if (dirty)
-		dirty->value = true;
+	MarkDirty(entity);
 }
 
 double GetRotation (Entity entity)
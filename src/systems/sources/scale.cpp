@@ -7,6 +7,7 @@
 
 #include "../scale.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../components/scale.hpp"
 #include "../../components/renderable.hpp"
@@ -25,6 +26,8 @@ void SetScale (Entity entity, double value)
 	scale->x = value;
 	scale->y = value;
 
+	MarkDirty(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -54,6 +57,8 @@ void SetScaleX (Entity entity, double value)
 
 	scale->x = value;
 
+	MarkDirty(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -83,6 +88,8 @@ void SetScaleY (Entity entity, double value)
 
 	scale->y = value;
 
+	MarkDirty(entity);
+
 	if (!renderable) return;
 
 	if (value == 0)
@@ -7,6 +7,7 @@
 
 #include "../scroll_factor.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../components/scroll_factor.hpp"
 
@@ -21,6 +22,8 @@ void SetScrollFactor (Entity entity, double x, double y)
 
 	scrollFactor->x = x;
 	scrollFactor->y = y;
+
+	MarkDirty(entity);
 }
 
 void SetScrollFactor (Entity entity, double value)
@@ -8,6 +8,7 @@
 #include "../size.hpp"
 
 #include <cmath>
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../utils/messages.hpp"
 
@@ -72,6 +73,8 @@ void SetDisplayWidth (Entity entity, double value)
 	auto frame = g_registry.get<Components::Frame>(textured->frame);
 
 	scale->x = value / frame.data.sourceSize.width;
+
+	MarkDirty(entity);
 }
 
 void SetDisplayHeight (Entity entity, double value)
@@ -83,6 +86,8 @@ void SetDisplayHeight (Entity entity, double value)
 	auto frame = g_registry.get<Components::Frame>(textured->frame);
 
 	scale->y = value / frame.data.sourceSize.height;
+
+	MarkDirty(entity);
 }
 
 void SetSizeToFrame (Entity entity, Entity frame)
@@ -110,6 +115,8 @@ void SetSizeToFrame (Entity entity, Entity frame)
 
 	size->width = fr->data.sourceSize.width;
 	size->height = fr->data.sourceSize.height;
+
+	MarkDirty(entity);
 }
 
 void SetSize (Entity entity, double width, double height)
@@ -122,6 +129,8 @@ void SetSize (Entity entity, double width, double height)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetSize (Entity entity, double value)
@@ -139,6 +148,8 @@ void SetDisplaySize (Entity entity, double width, double height)
 
 	scale->x = width / frame.data.sourceSize.width;
 	scale->y = height / frame.data.sourceSize.height;
+
+	MarkDirty(entity);
 }
 
 void SetWidth (Entity entity, double value)
@@ -150,6 +161,8 @@ void SetWidth (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 void SetHeight (Entity entity, double value)
@@ -161,6 +174,8 @@ void SetHeight (Entity entity, double value)
 
 	if (update)
 		update->update(entity);
+
+	MarkDirty(entity);
 }
 
 double GetWidth (Entity entity)
@@ -7,6 +7,7 @@
 
 #include "../textured.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../texture/texture_manager.hpp"
 
@@ -52,6 +53,8 @@ void SetCrop (Entity entity, int x, int y, int width, int height)
 
 		textured->isCropped = true;
 	}
+
+	MarkDirty(entity);
 }
 
 void SetCrop (Entity entity, Rectangle rect)
@@ -92,6 +95,8 @@ void SetFrame (Entity entity, std::string frameName, bool updateSize, bool updat
 
 	textured->frame = GetFrame(textured->texture, frameName);
 
+	MarkDirty(entity);
+
 	Components::Frame *frame;
 	if (textured->frame == entt::null)
 	{
@@ -164,6 +169,8 @@ void ResetCropObject (Entity entity)
 
 	crop->data.flipX = false;
 	crop->data.flipY = false;
+
+	MarkDirty(entity);
 }
 
 bool IsCropped (Entity entity)
@@ -8,6 +8,7 @@
 #include "../type.hpp"
 #include "../../components/type.hpp"
 #include "../../utils/assert.hpp"
+#include <unordered_map>
 
 namespace Zen {
 
@@ -21,4 +22,25 @@ std::string GetType (Entity entity)
 	return blendMode->type;
 }
 
+int GetTypeId (Entity entity)
+{
+	auto type = g_registry.try_get<Components::Type>(entity);
+	ZEN_ASSERT(type, "The entity has no 'Type' component.");
+
+	return type->id;
+}
+
+int InternType (const std::string& type)
+{
+	static std::unordered_map<std::string, int> ids;
+
+	return ids.emplace(type, ids.size() + 1).first->second;
+}
+
+void SetType (Entity entity, const std::string& type)
+{
+	g_registry.emplace_or_replace<Components::Type>(entity, type,
+			InternType(type));
+}
+
 }	// namespace Zen
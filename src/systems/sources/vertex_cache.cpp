@@ -0,0 +1,35 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "../vertex_cache.hpp"
+
+#include "../../components/vertex_cache.hpp"
+#include "../../components/dirty.hpp"
+
+namespace Zen {
+
+extern entt::registry g_registry;
+
+void SetVertexCache (Entity entity, bool value)
+{
+	if (value)
+	{
+		g_registry.emplace_or_replace<Components::VertexCache>(entity);
+		g_registry.emplace_or_replace<Components::Dirty>(entity);
+	}
+	else
+	{
+		g_registry.remove_if_exists<Components::VertexCache>(entity);
+	}
+}
+
+bool HasVertexCache (Entity entity)
+{
+	return g_registry.has<Components::VertexCache>(entity);
+}
+
+}	// namespace Zen
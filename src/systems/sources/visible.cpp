@@ -7,6 +7,7 @@
 
 #include "../visible.hpp"
 
+#include "../dirty.hpp"
 #include "../../utils/assert.hpp"
 #include "../../components/visible.hpp"
 #include "../../components/renderable.hpp"
@@ -43,6 +44,8 @@ void SetVisible (Entity entity, bool value)
 			// Turn the visibility bit to 0
 			renderable->flags &= ~FLAG;
 	}
+
+	MarkDirty(entity);
 }
 
 }	// namespace Zen
@@ -15,6 +15,37 @@ namespace Zen {
 
 std::string GetType (Entity entity);
 
+/**
+ * @since 0.0.0
+ *
+ * @param entity The entity.
+ *
+ * @return The interned id of the type of the entity.
+ */
+int GetTypeId (Entity entity);
+
+/**
+ * Returns the id of a type name, giving it a new one the first time it is
+ * seen.
+ *
+ * @since 0.0.0
+ *
+ * @param type The type name.
+ *
+ * @return The interned id, starting from `1`.
+ */
+int InternType (const std::string& type);
+
+/**
+ * Sets the type of an entity, with its interned id.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The entity.
+ * @param type The type name.
+ */
+void SetType (Entity entity, const std::string& type);
+
 }	// namespace Zen
 
 #endif
@@ -0,0 +1,41 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_SYSTEMS_VERTEX_CACHE_HPP
+#define ZEN_SYSTEMS_VERTEX_CACHE_HPP
+
+#include "../ecs/entity.hpp"
+
+namespace Zen {
+
+/**
+ * Makes a sprite retain its vertices between frames.
+ *
+ * The vertices are only generated again when its position, rotation, scale,
+ * origin, frame, crop, tint, alpha, flip or scroll factor is set, or when the
+ * camera rendering it changes. This suits static backgrounds and level
+ * decoration.
+ *
+ * @since 0.0.0
+ *
+ * @param entity The sprite.
+ * @param value `true` to retain the vertices, `false` to stop.
+ */
+void SetVertexCache (Entity entity, bool value = true);
+
+/**
+ * @since 0.0.0
+ *
+ * @param entity The sprite.
+ *
+ * @return `true` if the sprite retains its vertices.
+ */
+bool HasVertexCache (Entity entity);
+
+}	// namespace Zen
+
+#endif
@@ -552,31 +552,50 @@ std::vector<int> TextManager::stringToUnicodes (std::string text)
 {
 	std::vector<int> characters;
 
-	for (size_t i = 0; i < text.length();) {
-		int cplen = 1;
-		if ((text[i] & 0xf8) == 0xf0)
-			cplen = 4;
-		else if ((text[i] & 0xf0) == 0xe0)
-			cplen = 3;
-		else if ((text[i] & 0xe0) == 0xc0)
-			cplen = 2;
-
-		if ((i + cplen) > text.length())
-			cplen = 1;
-
-		unsigned int c = 0;
-		for (int j = 0; j < cplen; j++) {
-			unsigned char ch = text[i + j];
-			c <<= 8;
-			c |= ch;
-		}
+	for (size_t i = 0; i < text.length();)
+		characters.emplace_back(decodeCharacter(text, &i));
+
+	return characters;
+}
 
-		characters.emplace_back(c);
+std::span<int> TextManager::stringToUnicodes (const std::string& text,
+		FrameArena& arena)
+{
+	// There are at most as many characters as bytes
+	auto characters = arena.allocate<int>(text.length());
+	size_t count = 0;
+
+	for (size_t i = 0; i < text.length();)
+		characters[count++] = decodeCharacter(text, &i);
+
+	return characters.first(count);
+}
 
-		i += cplen;
+int TextManager::decodeCharacter (const std::string& text, size_t *index)
+{
+	size_t i = *index;
+
+	int cplen = 1;
+	if ((text[i] & 0xf8) == 0xf0)
+		cplen = 4;
+	else if ((text[i] & 0xf0) == 0xe0)
+		cplen = 3;
+	else if ((text[i] & 0xe0) == 0xc0)
+		cplen = 2;
+
+	if ((i + cplen) > text.length())
+		cplen = 1;
+
+	unsigned int c = 0;
+	for (int j = 0; j < cplen; j++) {
+		unsigned char ch = text[i + j];
+		c <<= 8;
+		c |= ch;
 	}
 
-	return characters;
+	*index += cplen;
+
+	return c;
 }
 
 Rectangle TextManager::getTextBoundingBox (std::vector<int> &characters, TextStyle &style)
@@ -666,6 +685,35 @@ std::vector<Rectangle> TextManager::getLinesBoundingBox (
 	return linesBbox;
 }
 
+std::span<double> TextManager::getLinesWidth (
+		std::span<const int> characters, TextStyle &style, FrameArena& arena)
+{
+	size_t lineCount = 1 + std::count(characters.begin(), characters.end(),
+			'\n');
+
+	auto linesWidth = arena.allocate<double>(lineCount);
+	size_t line = 0;
+
+	linesWidth[0] = 0.;
+
+	for (auto character : characters) {
+		if (character == '\n') {
+			linesWidth[++line] = 0.;
+		} else {
+			auto &glyph = glyphCache
+				[style.fontFamily]
+				[style.fontSize]
+				[style.decoration]
+				[style.outline]
+				[character];
+
+			linesWidth[line] += glyph.advanceX;
+		}
+	}
+
+	return linesWidth;
+}
+
 std::vector<int> TextManager::wrapText (std::vector<int> text, TextStyle style)
 {
 	if (style.wrapWidth <= 0)
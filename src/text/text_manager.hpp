@@ -7,6 +7,7 @@
 
 #include <string>
 #include <map>
+#include <span>
 #include <vector>
 #include "glyph.hpp"
 #include "text_style.hpp"
@@ -14,6 +15,7 @@
 #include "const.hpp"
 #include "../geom/types/rectangle.hpp"
 #include "../renderer/types/gl_types.hpp"
+#include "../utils/memory/frame_arena.hpp"
 
 // FreeType 2
 #include <ft2build.h>
@@ -154,11 +156,50 @@ public:
 
 	std::vector<int> stringToUnicodes (std::string text);
 
+	/**
+	 * Converts an UTF-8 string to unicodes, stored in the given arena.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param text The string to convert.
+	 * @param arena The arena to allocate the unicodes from.
+	 *
+	 * @return The unicodes of the string.
+	 */
+	std::span<int> stringToUnicodes (const std::string& text,
+			FrameArena& arena);
+
+	/**
+	 * Decodes the UTF-8 character at the given index of a string.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param text The string.
+	 * @param index The index of the character, moved to the next one.
+	 *
+	 * @return The unicode of the character.
+	 */
+	int decodeCharacter (const std::string& text, size_t *index);
+
 	Rectangle getTextBoundingBox (std::vector<int> &characters, TextStyle &style);
 
 	std::vector<Rectangle> getLinesBoundingBox (std::vector<int> &characters,
 			TextStyle &style);
 
+	/**
+	 * Computes the width of each line of a text, stored in the given arena.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param characters The unicodes of the text.
+	 * @param style The style of the text.
+	 * @param arena The arena to allocate the widths from.
+	 *
+	 * @return The width of each line.
+	 */
+	std::span<double> getLinesWidth (std::span<const int> characters,
+			TextStyle &style, FrameArena& arena);
+
 	std::vector<int> wrapText (std::vector<int> text, TextStyle style);
 
 	/**
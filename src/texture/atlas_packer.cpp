@@ -0,0 +1,128 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "atlas_packer.hpp"
+
+#include <algorithm>
+#include <climits>
+
+namespace Zen {
+
+AtlasPacker::AtlasPacker (int width_, int height_, int padding_)
+	: width (width_)
+	, height (height_)
+	, padding (padding_)
+{
+	clear();
+}
+
+void AtlasPacker::clear ()
+{
+	skyline.clear();
+	skyline.push_back({0, 0, width});
+
+	usedArea = 0;
+}
+
+double AtlasPacker::getOccupancy () const
+{
+	return static_cast<double>(usedArea) / (width * height);
+}
+
+int AtlasPacker::fit (std::size_t index_, int width_, int height_) const
+{
+	int x_ = skyline[index_].x;
+
+	if (x_ + width_ > width)
+		return -1;
+
+	// The rectangle rests on the highest segment it spans
+	int y_ = 0;
+	int left_ = width_;
+	for (size_t i = index_; left_ > 0; i++) {
+		y_ = std::max(y_, skyline[i].y);
+
+		if (y_ + height_ > height)
+			return -1;
+
+		left_ -= skyline[i].width;
+	}
+
+	return y_;
+}
+
+bool AtlasPacker::insert (int width_, int height_, int *x_, int *y_)
+{
+	int w_ = width_ + padding;
+	int h_ = height_ + padding;
+
+	int bestIndex_ = -1;
+	int bestTop_ = INT_MAX;
+	int bestWidth_ = INT_MAX;
+	int bestY_ = 0;
+
+	// Bottom-left: lowest top edge, then narrowest segment
+	for (size_t i = 0; i < skyline.size(); i++) {
+		int y = fit(i, w_, h_);
+
+		if (y < 0)
+			continue;
+
+		if (y + h_ < bestTop_
+				|| (y + h_ == bestTop_ && skyline[i].width < bestWidth_)) {
+			bestIndex_ = i;
+			bestTop_ = y + h_;
+			bestWidth_ = skyline[i].width;
+			bestY_ = y;
+		}
+	}
+
+	if (bestIndex_ < 0)
+		return false;
+
+	Segment segment_ {skyline[bestIndex_].x, bestY_ + h_, w_};
+	skyline.insert(skyline.begin() + bestIndex_, segment_);
+
+	// Shrink or remove the segments now under the new one
+	size_t next_ = bestIndex_ + 1;
+	while (next_ < skyline.size()) {
+		int overlap_ = segment_.x + segment_.width - skyline[next_].x;
+
+		if (overlap_ <= 0)
+			break;
+
+		if (overlap_ < skyline[next_].width) {
+			skyline[next_].x += overlap_;
+			skyline[next_].width -= overlap_;
+
+			break;
+		}
+
+		skyline.erase(skyline.begin() + next_);
+	}
+
+	// Merge the neighbouring segments of the same height
+	size_t i = 0;
+	while (i + 1 < skyline.size()) {
+		if (skyline[i].y == skyline[i + 1].y) {
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		}
+		else {
+			i++;
+		}
+	}
+
+	*x_ = segment_.x;
+	*y_ = bestY_;
+
+	usedArea += static_cast<long>(width_) * height_;
+
+	return true;
+}
+
+}	// namespace Zen
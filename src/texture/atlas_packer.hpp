@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TEXTURES_ATLAS_PACKER_HPP
+#define ZEN_TEXTURES_ATLAS_PACKER_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * Packs rectangles into a fixed size page, using the skyline bottom-left
+ * heuristic.
+ *
+ * The packer only does the bookkeeping of the free space, it never touches
+ * any pixel. It is used by the TextureManager to place the individually
+ * loaded images into shared atlas pages.
+ *
+ * @since 0.0.0
+ */
+class AtlasPacker
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param width The width of the page.
+	 * @param height The height of the page.
+	 * @param padding The space to leave around each rectangle.
+	 */
+	AtlasPacker (int width, int height, int padding = 0);
+
+	/**
+	 * Finds a place for a rectangle of the given size and reserves it.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param width The width of the rectangle.
+	 * @param height The height of the rectangle.
+	 * @param x A pointer to store the x position of the rectangle in.
+	 * @param y A pointer to store the y position of the rectangle in.
+	 *
+	 * @return `true` if the rectangle was placed, `false` if the page is
+	 * full.
+	 */
+	bool insert (int width, int height, int *x, int *y);
+
+	/**
+	 * Frees all the space of the page.
+	 *
+	 * @since 0.0.0
+	 */
+	void clear ();
+
+	/**
+	 * The ratio of the page area that is used, between 0 and 1.
+	 *
+	 * @since 0.0.0
+	 */
+	double getOccupancy () const;
+
+	/**
+	 * The width of the page.
+	 *
+	 * @since 0.0.0
+	 */
+	int width;
+
+	/**
+	 * The height of the page.
+	 *
+	 * @since 0.0.0
+	 */
+	int height;
+
+	/**
+	 * The space left around each rectangle, so the filtering doesn't sample
+	 * the neighbouring images.
+	 *
+	 * @since 0.0.0
+	 */
+	int padding;
+
+private:
+	/**
+	 * A horizontal segment of the skyline. Everything below it is used.
+	 *
+	 * @since 0.0.0
+	 */
+	struct Segment
+	{
+		int x, y, width;
+	};
+
+	/**
+	 * Computes the lowest position a rectangle can take if it starts at the
+	 * given segment.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param index The index of the segment.
+	 * @param width The width of the rectangle.
+	 * @param height The height of the rectangle.
+	 *
+	 * @return The y position of the rectangle, or -1 if it doesn't fit.
+	 */
+	int fit (std::size_t index, int width, int height) const;
+
+	/**
+	 * The segments of the skyline, from left to right.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<Segment> skyline;
+
+	/**
+	 * The area used by the packed rectangles.
+	 *
+	 * @since 0.0.0
+	 */
+	long usedArea = 0;
+};
+
+}	// namespace Zen
+
+#endif
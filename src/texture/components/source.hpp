@@ -103,6 +103,21 @@ struct TextureSource
 	 * @since 0.0.0
 	 */
 	int glIndexCounter = -1;
+
+	/**
+	 * The texture array this source is packed in, if any. See
+	 * `TextureArrays`.
+	 *
+	 * @since 0.0.0
+	 */
+	int glArray = -1;
+
+	/**
+	 * The layer of this source in its texture array.
+	 *
+	 * @since 0.0.0
+	 */
+	int glLayer = 0;
 };
 
 } // namespace Components
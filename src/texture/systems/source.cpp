@@ -22,7 +22,7 @@ extern entt::registry g_registry;
 extern Window g_window;
 extern Renderer g_renderer;
 
-Entity CreateTextureSource (Entity texture, std::string src, int index)
+SDL_Surface* LoadTextureSurface (std::string src)
 {
 	SDL_Surface *surface = nullptr;
 
@@ -50,9 +50,17 @@ Entity CreateTextureSource (Entity texture, std::string src, int index)
 
 	// Check if the surface loaded correctly
 	if (!surface)
-	{
 		MessageError("Surface couldn't be created: ", IMG_GetError());
 
+	return surface;
+}
+
+Entity CreateTextureSource (Entity texture, std::string src, int index)
+{
+	SDL_Surface *surface = LoadTextureSurface(src);
+
+	if (!surface)
+	{
 		return entt::null;
 	}
 	else
@@ -84,6 +92,75 @@ Entity CreateTextureSource (Entity texture, std::string src, int index)
 	}
 }
 
+Entity CreateBlankTextureSource (Entity texture, int width, int height,
+		int index)
+{
+	// New surfaces are zeroed, so fully transparent
+	SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32,
+			SDL_PIXELFORMAT_RGBA32);
+
+	if (!surface)
+	{
+		MessageError("Surface couldn't be created: ", SDL_GetError());
+
+		return entt::null;
+	}
+
+	auto source = g_registry.create();
+	auto &c = g_registry.emplace<Components::TextureSource>(
+			source,
+			texture,
+			"",
+			index,
+			1.0,
+			width,
+			height,
+			0,
+			surface,
+			0,
+			-1
+			);
+
+	// No mipmaps nor texture array, as the regions are uploaded later on
+	GLenum filter = (g_renderer.config.antialias) ? GL_LINEAR : GL_NEAREST;
+
+	c.glTexture = g_renderer.createTexture2D(0, filter, filter,
+			GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_RGBA, surface);
+
+	SDL_FreeSurface(c.tmp);
+	c.tmp = nullptr;
+
+	return source;
+}
+
+Entity CreateRenderTextureSource (Entity texture, int width, int height,
+		int index)
+{
+	auto source = g_registry.create();
+	auto &c = g_registry.emplace<Components::TextureSource>(
+			source,
+			texture,
+			"",
+			index,
+			1.0,
+			width,
+			height,
+			0,
+			nullptr,
+			0,
+			-1
+			);
+
+	// No mipmaps, as the content changes whenever it is drawn to
+	GLenum filter = (g_renderer.config.antialias) ? GL_LINEAR : GL_NEAREST;
+
+	c.glTexture = g_renderer.createTexture2D(0, filter, filter,
+			GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_RGBA, nullptr, width,
+			height);
+
+	return source;
+}
+
 void DestroyTextureSource (Entity source)
 {
 	auto src = g_registry.try_get<Components::TextureSource>(source);
@@ -92,6 +169,8 @@ void DestroyTextureSource (Entity source)
 	if (src->glTexture)
 		glDeleteTextures(1, &src->glTexture);
 
+	g_renderer.textureArrays.remove(source);
+
 	g_registry.destroy(source);
 }
 
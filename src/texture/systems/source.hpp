@@ -9,12 +9,60 @@
 #define ZEN_TEXTURES_SYSTEMS_SOURCE_HPP
 
 #include <string>
+#include <SDL2/SDL_surface.h>
 #include "../../ecs/entity.hpp"
 
 namespace Zen {
 
+/**
+ * Loads the pixels of a Texture Source.
+ *
+ * @since 0.0.0
+ *
+ * @param src A path to an image file, or a Base64 image data.
+ *
+ * @return The loaded surface, to be freed by the caller, or `nullptr` if it
+ * couldn't be loaded.
+ */
+SDL_Surface* LoadTextureSurface (std::string src);
+
 Entity CreateTextureSource (Entity texture, std::string src, int index);
 
+/**
+ * Creates a transparent Texture Source, to be filled region by region.
+ *
+ * This is used for the pages of the automatic atlas of the TextureManager.
+ *
+ * @since 0.0.0
+ *
+ * @param texture The texture to which the Source belongs to.
+ * @param width The width of the Source.
+ * @param height The height of the Source.
+ * @param index The index of the Source in its texture.
+ *
+ * @return The Texture Source, or `entt::null` if it couldn't be created.
+ */
+Entity CreateBlankTextureSource (Entity texture, int width, int height,
+		int index = 0);
+
+/**
+ * Creates a Texture Source with an empty OpenGL texture, to be drawn to
+ * through a framebuffer.
+ *
+ * This is used by the Render Textures.
+ *
+ * @since 0.0.0
+ *
+ * @param texture The texture to which the Source belongs to.
+ * @param width The width of the Source.
+ * @param height The height of the Source.
+ * @param index The index of the Source in its texture.
+ *
+ * @return The Texture Source.
+ */
+Entity CreateRenderTextureSource (Entity texture, int width, int height,
+		int index = 0);
+
 void DestroyTextureSource (Entity source);
 
 }	// namespace Zen
@@ -174,6 +174,12 @@ Entity GetFrame (Entity texture, std::string name)
 	{
 		frame = tx->firstFrame;
 	}
+	else if (g_registry.valid(tx->firstFrame) &&
+		g_registry.get<Components::Frame>(tx->firstFrame).name == name)
+	{
+		// Also covers the packed images, whose source is an atlas page
+		frame = tx->firstFrame;
+	}
 	else
 	{
 		for (auto entity : g_registry.view<Components::Frame>())
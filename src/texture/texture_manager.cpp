@@ -13,9 +13,12 @@
 #include "parsers/sprite_sheet_atlas.hpp"
 
 #include <tuple>
+#include <algorithm>
 #include <utility>
 #include <fstream>
+#include "../utils/assert.hpp"
 #include "../utils/messages.hpp"
+#include "../renderer/renderer.hpp"
 #include "../utils/map/emplace.hpp"
 #include "../core/config.hpp"
 #include "../window/window.hpp"
@@ -23,8 +26,10 @@
 #include "components/frame.hpp"
 #include "systems/texture.hpp"
 #include "systems/frame.hpp"
+#include "systems/source.hpp"
 #include "../geom/rectangle.hpp"
 #include "../display/color.hpp"
+#include "../components/render_texture.hpp"
 #include "../components/transform_matrix.hpp"
 #include "../systems/transform_matrix.hpp"
 
@@ -32,6 +37,7 @@ namespace Zen {
 
 extern entt::registry g_registry;
 extern Window g_window;
+extern Renderer g_renderer;
 
 TextureManager::~TextureManager ()
 {
@@ -100,6 +106,18 @@ Entity TextureManager::addImage (std::string key_, std::string path_)
 	if (!checkKey(key_))
 		return texture_;
 
+	if (config->autoAtlas)
+	{
+		texture_ = addPackedImage(key_, path_);
+
+		if (texture_ != entt::null)
+		{
+			emit("add", key_);
+
+			return texture_;
+		}
+	}
+
 	texture_ = create(key_, path_);
 
 	if (texture_ != entt::null)
@@ -134,31 +152,111 @@ Entity TextureManager::addImage (std::string key_, std::string path_)
 	return texture_;
 }
 
-Entity TextureManager::addRenderTexture (std::string key_, Entity renderTexture_)
+Entity TextureManager::addPackedImage (std::string key_, std::string path_)
 {
-		/*
-		 * TODO
-	Texture *texture_ = nullptr;
+	SDL_Surface *surface_ = LoadTextureSurface(path_);
 
-	if (checkKey(key_))
+	if (!surface_)
+		return entt::null;
+
+	// Too large images are loaded again by `create`, with their own texture
+	if (surface_->w > config->autoAtlasMaxSize ||
+		surface_->h > config->autoAtlasMaxSize)
 	{
-		texture_ = create(key_, renderTexture_);
+		SDL_FreeSurface(surface_);
+
+		return entt::null;
+	}
 
-		 int sourceIndex_ = 0;
+	SDL_Surface *pixels_ = SDL_ConvertSurfaceFormat(
+			surface_, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(surface_);
+
+	if (!pixels_)
+		return entt::null;
 
-		 texture_->add("__BASE",
-		 sourceIndex_,
-		 0,
-		 0,
-		 renderTexture_.width_,
-		 renderTexture_.height_);
+	int width_ = pixels_->w;
+	int height_ = pixels_->h;
+	int x_ = 0;
+	int y_ = 0;
 
-		 emit("add", key_);
+	AtlasPage *page_ = nullptr;
+	for (auto& p_ : atlasPages)
+	{
+		if (p_.packer.insert(width_, height_, &x_, &y_))
+		{
+			page_ = &p_;
+			break;
+		}
+	}
+
+	// Every page is full, start a new one
+	if (!page_)
+	{
+		int size_ = config->autoAtlasPageSize;
+		int maxSize_ = config->renderConfig.maxTextureSize;
+
+		if (maxSize_ > 0)
+			size_ = std::min(size_, maxSize_);
+
+		Entity pageTexture_ = g_registry.create();
+		g_registry.emplace<Components::Texture>(pageTexture_,
+				"__ATLAS" + std::to_string(atlasPages.size()), 0, entt::null);
+
+		Entity source_ = CreateBlankTextureSource(pageTexture_, size_, size_);
+
+		if (source_ == entt::null)
+		{
+			g_registry.destroy(pageTexture_);
+			SDL_FreeSurface(pixels_);
+
+			return entt::null;
+		}
+
+		// Leave a gap between the images so the filtering doesn't bleed
+		atlasPages.push_back({pageTexture_, source_, AtlasPacker(size_, size_, 2)});
+		page_ = &atlasPages.back();
+
+		if (!page_->packer.insert(width_, height_, &x_, &y_))
+		{
+			SDL_FreeSurface(pixels_);
+
+			return entt::null;
+		}
+	}
+
+	auto& source_ = g_registry.get<Components::TextureSource>(page_->source);
+	g_renderer.updateTexture2D(source_.glTexture, x_, y_, pixels_);
+
+	SDL_FreeSurface(pixels_);
+
+	// The Texture has no source of its own, its frame points into the page
+	Entity texture_ = g_registry.create();
+	auto& tx_ = g_registry.emplace<Components::Texture>(texture_, key_, 1,
+			entt::null);
+
+	tx_.firstFrame = CreateFrame(page_->source, "__BASE", x_, y_, width_,
+			height_);
+
+	list.emplace(key_, texture_);
+
+	return texture_;
+}
+
+Entity TextureManager::addRenderTexture (std::string key_, Entity renderTexture_)
+{
+	Entity texture_ = create(key_, renderTexture_);
+
+	if (texture_ != entt::null)
+	{
+		auto& rt_ = g_registry.get<Components::RenderTexture>(renderTexture_);
+
+		AddFrame(texture_, "__BASE", 0, 0, 0, rt_.width, rt_.height);
+
+		emit("add", key_);
 	}
 
 	return texture_;
-		 */
-	return entt::null;
 }
 
 Entity TextureManager::addAtlas (
@@ -387,8 +485,20 @@ Entity TextureManager::create (std::string key_, std::string source_)
 
 Entity TextureManager::create (std::string key_, Entity renderTexture_)
 {
-	// TODO
-	return entt::null;
+	auto rt_ = g_registry.try_get<Components::RenderTexture>(renderTexture_);
+	ZEN_ASSERT(rt_, "The entity has no 'RenderTexture' component.");
+
+	if (!checkKey(key_))
+		return entt::null;
+
+	Entity texture_ = g_registry.create();
+	g_registry.emplace<Components::Texture>(texture_, key_, 0, entt::null);
+
+	rt_->source = CreateRenderTextureSource(texture_, rt_->width, rt_->height);
+
+	list.emplace(key_, texture_);
+
+	return texture_;
 }
 
 bool TextureManager::exists (std::string key_)
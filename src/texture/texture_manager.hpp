@@ -20,6 +20,7 @@
 #include "../event/event_emitter.hpp"
 #include "../display/types/color.hpp"
 #include "sprite_sheet_config.hpp"
+#include "atlas_packer.hpp"
 #include "components/texture.hpp"
 
 #include "../core/config.fwd.hpp"
@@ -84,6 +85,9 @@ public:
 	/**
 	 * Adds a new Texture to the TextureManager created from the given image.
 	 *
+	 * If the `autoAtlas` option is set and the image is small enough, it is
+	 * packed into a shared atlas page instead of getting its own texture.
+	 *
 	 * @since 0.0.0
 	 *
 	 * @param key_ The unique key of the Texture.
@@ -247,7 +251,8 @@ public:
 	Entity create (std::string key_, std::string source_);
 
 	/**
-	 * @todo Create texture from renderTexture game object.
+	 * Creates a Texture drawn to by a Render Texture Game Object, and sets the
+	 * Texture Source of its `RenderTexture` component.
 	 *
 	 * @overload
 	 * @since 0.0.0
@@ -470,6 +475,41 @@ private:
 	 * @since 0.0.0
 	 */
 	std::map<Entity, SDL_Surface*> alphaCache;
+
+	/**
+	 * A page of the automatic atlas.
+	 *
+	 * @since 0.0.0
+	 */
+	struct AtlasPage
+	{
+		Entity texture;
+
+		Entity source;
+
+		AtlasPacker packer;
+	};
+
+	/**
+	 * The pages of the automatic atlas, in creation order.
+	 *
+	 * @since 0.0.0
+	 */
+	std::vector<AtlasPage> atlasPages;
+
+	/**
+	 * Packs an image into an atlas page, creating a new page if all are
+	 * full.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param key_ The unique string-based key of the Texture.
+	 * @param path_ The path to the image file, or the Base64 image data.
+	 *
+	 * @return The newly created Texture, or `entt::null` if the image is too
+	 * large to be packed or couldn't be loaded.
+	 */
+	Entity addPackedImage (std::string key_, std::string path_);
 };
 
 }	// namespace Zen
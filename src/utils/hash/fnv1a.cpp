@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "fnv1a.hpp"
+
+namespace Zen {
+
+std::uint64_t Fnv1a (const void *data, std::size_t size, std::uint64_t hash)
+{
+	auto *bytes = static_cast<const unsigned char*>(data);
+
+	for (std::size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+}	// namespace Zen
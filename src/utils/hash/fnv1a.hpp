@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_UTILS_HASH_FNV1A_HPP
+#define ZEN_UTILS_HASH_FNV1A_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zen {
+
+/**
+ * The initial value of a FNV-1a hash.
+ *
+ * @since 0.0.0
+ */
+const std::uint64_t FNV1A_OFFSET = 0xcbf29ce484222325ull;
+
+/**
+ * Hashes bytes with the 64 bits FNV-1a function.
+ *
+ * Unlike `std::hash`, the result is the same on every run and with every
+ * standard library, so it can name files or be stored.
+ *
+ * @since 0.0.0
+ *
+ * @param data The bytes to hash.
+ * @param size The number of bytes.
+ * @param hash The hash to continue, to hash several buffers as one.
+ *
+ * @return The hash.
+ */
+std::uint64_t Fnv1a (const void *data, std::size_t size,
+		std::uint64_t hash = FNV1A_OFFSET);
+
+}	// namespace Zen
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "frame_arena.hpp"
+
+#include <algorithm>
+
+#ifdef ZEN_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<long> heapAllocations {0};
+
+}	// namespace
+
+// Counts every allocation of the program, to check the frames don't make any
+void* operator new (std::size_t size)
+{
+	heapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (void *ptr = std::malloc(size ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)
+{
+	return ::operator new(size);
+}
+
+// The over-aligned allocations don't go through the plain operator new
+void* operator new (std::size_t size, std::align_val_t alignment)
+{
+	heapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+	auto align = static_cast<std::size_t>(alignment);
+
+#ifdef _WIN32
+	if (void *ptr = _aligned_malloc(size ? size : 1, align))
+		return ptr;
+#else
+	// The size given to aligned_alloc must be a multiple of the alignment
+	if (void *ptr = std::aligned_alloc(align,
+				(size ? size + align - 1 : align) / align * align))
+		return ptr;
+#endif
+
+	throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size, std::align_val_t alignment)
+{
+	return ::operator new(size, alignment);
+}
+
+void operator delete (void* ptr, std::align_val_t) noexcept
+{
+#ifdef _WIN32
+	_aligned_free(ptr);
+#else
+	std::free(ptr);
+#endif
+}
+
+void operator delete[] (void* ptr, std::align_val_t alignment) noexcept
+{
+	::operator delete(ptr, alignment);
+}
+
+void operator delete (void* ptr, std::size_t, std::align_val_t alignment)
+	noexcept
+{
+	::operator delete(ptr, alignment);
+}
+
+void operator delete[] (void* ptr, std::size_t, std::align_val_t alignment)
+	noexcept
+{
+	::operator delete(ptr, alignment);
+}
+
+void operator delete (void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[] (void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete (void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[] (void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+#endif
+
+namespace Zen {
+
+long GetHeapAllocationCount ()
+{
+#ifdef ZEN_COUNT_ALLOCATIONS
+	return heapAllocations.load(std::memory_order_relaxed);
+#else
+	return -1;
+#endif
+}
+
+FrameArena::FrameArena (size_t capacity)
+{
+	blocks.reserve(8);
+	grow(capacity);
+}
+
+void* FrameArena::allocate (size_t size, size_t alignment)
+{
+	size_t start_ = (offset + alignment - 1) & ~(alignment - 1);
+
+	if (start_ + size > blocks.back().size) {
+		grow(size + alignment);
+		start_ = 0;
+	}
+
+	offset = start_ + size;
+
+	return blocks.back().data.get() + start_;
+}
+
+void FrameArena::grow (size_t size)
+{
+	size_t capacity_ = blocks.empty() ? 0 : blocks.back().size;
+
+	if (!blocks.empty())
+		previousUsed += offset;
+
+	blocks.push_back({});
+	blocks.back().size = std::max(size, capacity_ * 2);
+	blocks.back().data.reset(new std::byte[blocks.back().size]);
+
+	offset = 0;
+	blockAllocations++;
+}
+
+void FrameArena::reset ()
+{
+	// Replace the chained blocks by a single one fitting the whole frame
+	if (blocks.size() > 1) {
+		size_t capacity_ = getCapacity();
+
+		blocks.clear();
+		grow(capacity_);
+	}
+
+	offset = 0;
+	previousUsed = 0;
+
+	long count_ = GetHeapAllocationCount();
+
+	if (count_ >= 0)
+		lastFrameHeapAllocations = count_ - frameStartHeapAllocations;
+
+	frameStartHeapAllocations = count_;
+}
+
+size_t FrameArena::getUsed ()
+{
+	return previousUsed + offset;
+}
+
+size_t FrameArena::getCapacity ()
+{
+	size_t capacity_ = 0;
+
+	for (auto &block_ : blocks)
+		capacity_ += block_.size;
+
+	return capacity_;
+}
+
+}	// namespace Zen
@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_UTILS_MEMORY_FRAME_ARENA_HPP
+#define ZEN_UTILS_MEMORY_FRAME_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * A linear allocator for the temporary data of a single frame.
+ *
+ * Memory is handed out by bumping an offset, and everything is released at
+ * once by `reset`, at the start of each step. When a frame needs more than the
+ * current block, new blocks are chained for that frame, then merged into a
+ * single large enough block by the next `reset`, so steady-state frames don't
+ * touch the heap.
+ *
+ * Only trivially destructible types can be stored in it, as nothing is ever
+ * destroyed.
+ *
+ * @since 0.0.0
+ */
+class FrameArena
+{
+public:
+	/**
+	 * @since 0.0.0
+	 *
+	 * @param capacity The initial size of the arena, in bytes.
+	 */
+	FrameArena (size_t capacity = 64 * 1024);
+
+	/**
+	 * Allocates raw memory, valid until the next `reset`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param size The number of bytes.
+	 * @param alignment The alignment of the memory, a power of two.
+	 *
+	 * @return The allocated memory.
+	 */
+	void* allocate (size_t size, size_t alignment);
+
+	/**
+	 * Allocates an uninitialized array, valid until the next `reset`.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @tparam T The type of the elements.
+	 * @param count The number of elements.
+	 *
+	 * @return The allocated array.
+	 */
+	template <typename T>
+	std::span<T> allocate (size_t count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>,
+				"The frame arena never destroys its elements.");
+
+		if (count == 0)
+			return {};
+
+		T *data_ = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+
+		return {data_, count};
+	}
+
+	/**
+	 * Releases everything allocated since the previous call, merging the
+	 * blocks if the last frame overflowed.
+	 *
+	 * @since 0.0.0
+	 */
+	void reset ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of bytes allocated since the last `reset`.
+	 */
+	size_t getUsed ();
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The total size of the blocks of the arena, in bytes.
+	 */
+	size_t getCapacity ();
+
+	/**
+	 * The number of blocks the arena allocated on the heap since its creation.
+	 *
+	 * @since 0.0.0
+	 */
+	int blockAllocations = 0;
+
+	/**
+	 * The number of heap allocations made by the whole program during the last
+	 * frame, or `-1` if the library was not built with
+	 * `ZEN_COUNT_ALLOCATIONS`.
+	 *
+	 * @since 0.0.0
+	 */
+	long lastFrameHeapAllocations = -1;
+
+private:
+	/**
+	 * Chains a new block large enough for the given allocation.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param size The size of the allocation that didn't fit.
+	 */
+	void grow (size_t size);
+
+	struct Block
+	{
+		std::unique_ptr<std::byte[]> data;
+
+		size_t size = 0;
+	};
+
+	std::vector<Block> blocks;
+
+	/**
+	 * The offset of the next allocation in the last block.
+	 *
+	 * @since 0.0.0
+	 */
+	size_t offset = 0;
+
+	/**
+	 * The bytes used in the full blocks before the last one.
+	 *
+	 * @since 0.0.0
+	 */
+	size_t previousUsed = 0;
+
+	/**
+	 * The heap allocation count at the start of the frame.
+	 *
+	 * @since 0.0.0
+	 */
+	long frameStartHeapAllocations = 0;
+};
+
+/**
+ * @since 0.0.0
+ *
+ * @return The number of heap allocations made through `operator new` since
+ * the start of the program, or `-1` if the library was not built with
+ * `ZEN_COUNT_ALLOCATIONS`.
+ */
+long GetHeapAllocationCount ();
+
+}	// namespace Zen
+
+#endif
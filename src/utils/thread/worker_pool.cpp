@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "worker_pool.hpp"
+
+namespace Zen {
+
+WorkerPool::~WorkerPool ()
+{
+	stop();
+}
+
+void WorkerPool::start (int threads_)
+{
+	if (!threads.empty())
+		return;
+
+	stopping = false;
+
+	for (int i = 0; i < threads_; i++)
+		threads.emplace_back(&WorkerPool::work, this);
+}
+
+void WorkerPool::stop ()
+{
+	{
+		std::lock_guard<std::mutex> lock_(mutex);
+		stopping = true;
+	}
+
+	wake.notify_all();
+
+	for (auto &thread_ : threads)
+		thread_.join();
+
+	threads.clear();
+}
+
+int WorkerPool::size ()
+{
+	return threads.size();
+}
+
+void WorkerPool::run (int count, std::function<void(int)> job)
+{
+	if (count <= 0)
+		return;
+
+	// Nobody to share the work with
+	if (threads.empty() || count == 1) {
+		for (int i = 0; i < count; i++)
+			job(i);
+
+		return;
+	}
+
+	{
+		// Late threads may still be leaving the previous call
+		std::unique_lock<std::mutex> lock_(mutex);
+		done.wait(lock_, [this] { return activeThreads == 0; });
+
+		currentJob = std::move(job);
+		jobCount = count;
+		nextJob = 0;
+		pendingJobs = count;
+		generation++;
+	}
+
+	wake.notify_all();
+
+	// Help instead of waiting idle
+	drain();
+
+	// Also wait for the threads to leave, so none of them can pick a job of
+	// the next call with this one's state
+	std::unique_lock<std::mutex> lock_(mutex);
+	done.wait(lock_, [this] { return pendingJobs == 0 && activeThreads == 0; });
+
+	currentJob = nullptr;
+}
+
+void WorkerPool::drain ()
+{
+	int index_;
+
+	while ((index_ = nextJob++) < jobCount) {
+		currentJob(index_);
+
+		if (--pendingJobs == 0) {
+			std::lock_guard<std::mutex> lock_(mutex);
+			done.notify_all();
+		}
+	}
+}
+
+void WorkerPool::work ()
+{
+	int seen_ = 0;
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock_(mutex);
+			wake.wait(lock_, [&] { return stopping || generation != seen_; });
+
+			if (stopping)
+				return;
+
+			seen_ = generation;
+			activeThreads++;
+		}
+
+		drain();
+
+		std::lock_guard<std::mutex> lock_(mutex);
+		if (--activeThreads == 0)
+			done.notify_all();
+	}
+}
+
+}	// namespace Zen
@@ -0,0 +1,120 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_UTILS_THREAD_WORKER_POOL_HPP
+#define ZEN_UTILS_THREAD_WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Zen {
+
+/**
+ * A fixed set of threads running the jobs of a parallel loop.
+ *
+ * The threads sleep between two calls of `run`, so a pool can be kept around
+ * and used every frame.
+ *
+ * @since 0.0.0
+ */
+class WorkerPool
+{
+public:
+	~WorkerPool ();
+
+	/**
+	 * Starts the threads of this pool. Does nothing if it already runs.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param threads The number of threads to start.
+	 */
+	void start (int threads);
+
+	/**
+	 * Stops and joins the threads of this pool.
+	 *
+	 * @since 0.0.0
+	 */
+	void stop ();
+
+	/**
+	 * Calls the given job with every index from `0` to `count - 1`, spread
+	 * over the threads of this pool and the calling thread, and returns once
+	 * they are all done.
+	 *
+	 * The jobs run in no particular order and must not depend on each other.
+	 *
+	 * @since 0.0.0
+	 *
+	 * @param count The number of jobs.
+	 * @param job The function to call for each job.
+	 */
+	void run (int count, std::function<void(int)> job);
+
+	/**
+	 * @since 0.0.0
+	 *
+	 * @return The number of threads of this pool.
+	 */
+	int size ();
+
+private:
+	/**
+	 * The loop of a thread, waiting for new jobs.
+	 *
+	 * @since 0.0.0
+	 */
+	void work ();
+
+	/**
+	 * Runs jobs of the current `run` call until there are none left.
+	 *
+	 * @since 0.0.0
+	 */
+	void drain ();
+
+	std::vector<std::thread> threads;
+
+	std::mutex mutex;
+
+	std::condition_variable wake;
+
+	std::condition_variable done;
+
+	std::function<void(int)> currentJob;
+
+	int jobCount = 0;
+
+	std::atomic<int> nextJob {0};
+
+	std::atomic<int> pendingJobs {0};
+
+	/**
+	 * Incremented by every `run` call, so the threads know there is new work.
+	 *
+	 * @since 0.0.0
+	 */
+	int generation = 0;
+
+	/**
+	 * The number of threads working on the current `run` call.
+	 *
+	 * @since 0.0.0
+	 */
+	int activeThreads = 0;
+
+	bool stopping = false;
+};
+
+}	// namespace Zen
+
+#endif
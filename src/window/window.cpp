@@ -107,6 +107,10 @@ void Window::initGL ()
 
 int Window::createWindow ()
 {
+	// Nothing is drawn when the commands are only recorded
+	Uint32 visibility = (config->renderConfig.backend == RENDER_BACKEND::RECORD)
+		? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN;
+
 	// Create a window
 	window = SDL_CreateWindow(
 			config->title.c_str(),
@@ -114,7 +118,7 @@ int Window::createWindow ()
 			SDL_WINDOWPOS_UNDEFINED,
 			config->width,
 			config->height,
-			SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE
+			SDL_WINDOW_OPENGL | visibility | SDL_WINDOW_RESIZABLE
 			);
 	if (window == nullptr) {
 		MessageError("Window could not be created: %s\n", SDL_GetError());
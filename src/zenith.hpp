@@ -82,6 +82,7 @@
 #include "systems/transform.hpp"
 #include "systems/transform_matrix.hpp"
 #include "systems/transparent.hpp"
+#include "systems/vertex_cache.hpp"
 #include "systems/viewport.hpp"
 #include "systems/visible.hpp"
 #include "systems/zoom.hpp"
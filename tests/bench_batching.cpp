@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "test.hpp"
+
+namespace Zen {
+extern Renderer g_renderer;
+}
+
+using namespace Zen;
+
+namespace {
+
+/**
+ * Moves every sprite each frame, so their vertices are generated again, and
+ * times the steps once the frames settle. The sprites form a single run,
+ * batched by `MultiPipeline::batchSprites` on the main thread, or on the
+ * worker threads when asked for.
+ */
+class BatchingScene : public Scene
+{
+public:
+	static const int WARMUP_FRAMES = 30;
+
+	BatchingScene ()
+		: Scene("batching")
+	{}
+
+	void create (Data) override
+	{
+		sprites.resize(count);
+
+		for (int i = 0; i < count; i++) {
+			sprites[i] = add.image((i * 37) % Test::WIDTH,
+					(i * 53) % Test::HEIGHT,
+					(i % 3) ? "__WHITE" : "__DEFAULT");
+
+			SetScale(sprites[i], 0.5);
+		}
+	}
+
+	void update (Uint32, Uint32) override
+	{
+		if (frame > WARMUP_FRAMES + frames)
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+
+		// The time of the previous step, rendering included
+		if (frame > WARMUP_FRAMES) {
+			std::chrono::duration<double, std::milli> time = now - last;
+
+			best = std::min(best, time.count());
+			total += time.count();
+		}
+
+		for (int i = 0; i < count; i++)
+			SetRotation(sprites[i], frame * 0.01 * (i % 5));
+
+		last = now;
+		frame++;
+
+		if (frame > WARMUP_FRAMES + frames) {
+			stats = g_renderer.getStats();
+			Test::Quit();
+		}
+	}
+
+	std::vector<Entity> sprites;
+
+	int frame = 0;
+
+	std::chrono::steady_clock::time_point last;
+
+	static inline int count = 10000;
+
+	static inline int frames = 300;
+
+	static inline double best = 1e30;
+
+	static inline double total = 0.;
+
+	static inline RenderStats stats;
+};
+
+}	// namespace
+
+int main (int argc, char **argv)
+{
+	BatchingScene::count = (argc > 1) ? std::atoi(argv[1]) : 10000;
+	BatchingScene::frames = (argc > 2) ? std::atoi(argv[2]) : 300;
+	int threads = (argc > 3) ? std::atoi(argv[3]) : 0;
+
+	Test::Run<BatchingScene>([threads] (GameConfig& config) {
+		config.setBatchThreads(threads);
+	});
+
+	auto &stats = BatchingScene::stats;
+
+	std::printf("%d sprites, %d frames recorded, %d worker threads\n",
+			BatchingScene::count, BatchingScene::frames, threads);
+	std::printf("step: %8.3f ms average, %8.3f ms best\n",
+			BatchingScene::total / BatchingScene::frames, BatchingScene::best);
+	std::printf("draw calls: %d, flushes: %d, vertices: %d\n",
+			stats.drawCalls, stats.flushes, stats.vertices);
+
+	return 0;
+}
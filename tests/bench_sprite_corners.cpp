@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "sprite_corners_data.hpp"
+#include "../src/components/transform_matrix.hpp"
+#include "../src/systems/transform_matrix.hpp"
+
+using namespace Zen;
+
+namespace {
+
+const float WIDTH = 800.f,
+	  HEIGHT = 600.f;
+
+/**
+ * The corners as the Multi Pipeline computed them before the kernel, one
+ * corner at a time on a double matrix.
+ */
+double TransformMatrices (const SpriteTransforms& t, bool roundPixels)
+{
+	double sum = 0.;
+
+	for (size_t i = 0; i < t.size(); i++) {
+		Components::TransformMatrix m {t.a[i], t.b[i], t.c[i], t.d[i], t.tx[i],
+			t.ty[i]};
+
+		double x = t.x[i], y = t.y[i];
+		double xw = x + t.width[i], yh = y + t.height[i];
+
+		double tx0 = GetXRound(m, x, y, roundPixels);
+		double ty0 = GetYRound(m, x, y, roundPixels);
+		double tx1 = GetXRound(m, x, yh, roundPixels);
+		double ty1 = GetYRound(m, x, yh, roundPixels);
+		double tx2 = GetXRound(m, xw, yh, roundPixels);
+		double ty2 = GetYRound(m, xw, yh, roundPixels);
+		double tx3 = GetXRound(m, xw, y, roundPixels);
+		double ty3 = GetYRound(m, xw, y, roundPixels);
+
+		double l = std::min({tx0, tx1, tx2, tx3}),
+			   r = std::max({tx0, tx1, tx2, tx3}),
+			   top = std::min({ty0, ty1, ty2, ty3}),
+			   bottom = std::max({ty0, ty1, ty2, ty3});
+
+		if (l > WIDTH || r < 0 || top > HEIGHT || bottom < 0)
+			continue;
+
+		sum += tx0 + ty2;
+	}
+
+	return sum;
+}
+
+double SumCorners (const SpriteCorners& corners)
+{
+	double sum = 0.;
+
+	for (size_t i = 0; i < corners.visible.size(); i++)
+		if (corners.visible[i])
+			sum += corners.x[0][i] + corners.y[2][i];
+
+	return sum;
+}
+
+/**
+ * Runs a function several times and prints its best time per Sprite.
+ */
+template <typename F>
+void Measure (const char *name, size_t count, int repeats, F function)
+{
+	double best = 1e30;
+	double sum = 0.;
+
+	for (int r = 0; r < repeats; r++) {
+		auto start = std::chrono::steady_clock::now();
+
+		sum += function();
+
+		std::chrono::duration<double, std::nano> time =
+			std::chrono::steady_clock::now() - start;
+
+		best = std::min(best, time.count());
+	}
+
+	// The sum keeps the work from being optimized away
+	std::printf("%-24s %8.2f ns/sprite  (checksum %g)\n", name, best / count,
+			sum);
+}
+
+}	// namespace
+
+int main (int argc, char **argv)
+{
+	size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+	int repeats = (argc > 2) ? std::atoi(argv[2]) : 50;
+
+	SpriteTransforms transforms;
+	Test::FillSpriteTransforms(count, 1, &transforms);
+
+	SpriteCorners corners;
+	corners.resize(count);
+
+	std::printf("%zu sprites, best of %d runs\n", count, repeats);
+
+	for (bool roundPixels : {false, true}) {
+		std::printf("\nroundPixels = %d\n", roundPixels);
+
+		Measure("double matrix", count, repeats, [&] {
+			return TransformMatrices(transforms, roundPixels);
+		});
+
+		Measure("scalar kernel", count, repeats, [&] {
+			TransformSpriteCornersScalar(transforms, roundPixels, WIDTH, HEIGHT,
+					&corners);
+
+			return SumCorners(corners);
+		});
+
+		Measure("vector kernel", count, repeats, [&] {
+			TransformSpriteCorners(transforms, roundPixels, WIDTH, HEIGHT,
+					&corners);
+
+			return SumCorners(corners);
+		});
+	}
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TESTS_SPRITE_CORNERS_DATA_HPP
+#define ZEN_TESTS_SPRITE_CORNERS_DATA_HPP
+
+#include <cmath>
+#include <random>
+#include "../src/renderer/sprite_corners.hpp"
+
+namespace Zen::Test {
+
+/**
+ * Fills the transforms of a run of Sprites with random positions, rotations,
+ * scales, flips, origins and frame sizes, some of them off the screen.
+ *
+ * @since 0.0.0
+ *
+ * @param count The number of Sprites.
+ * @param seed The seed of the random values.
+ * @param transforms The transforms to fill.
+ */
+inline void FillSpriteTransforms (size_t count, unsigned int seed,
+		SpriteTransforms *transforms)
+{
+	std::mt19937 random (seed);
+	std::uniform_real_distribution<float> unit (0.f, 1.f);
+
+	transforms->resize(count);
+
+	for (size_t i = 0; i < count; i++) {
+		// A quarter are axis-aligned, the most common case
+		float rotation = (i % 4) ? (unit(random) * 2.f - 1.f) * 3.14159265f
+			: 0.f;
+		float scaleX = 0.2f + unit(random) * 2.8f;
+		float scaleY = 0.2f + unit(random) * 2.8f;
+
+		// Flipped Sprites have a negative scale
+		if (i % 3 == 1)
+			scaleX = -scaleX;
+		if (i % 5 == 2)
+			scaleY = -scaleY;
+
+		float width = 1.f + std::floor(unit(random) * 128.f);
+		float height = 1.f + std::floor(unit(random) * 128.f);
+
+		// Around the screen, and sometimes far from it
+		float range = (i % 7 == 3) ? 5000.f : 1000.f;
+		float x = (unit(random) - 0.1f) * range;
+		float y = (unit(random) - 0.1f) * range;
+
+		float cos = std::cos(rotation);
+		float sin = std::sin(rotation);
+
+		transforms->a[i] = cos * scaleX;
+		transforms->b[i] = sin * scaleX;
+		transforms->c[i] = -sin * scaleY;
+		transforms->d[i] = cos * scaleY;
+		transforms->tx[i] = x;
+		transforms->ty[i] = y;
+
+		transforms->x[i] = -unit(random) * width;
+		transforms->y[i] = -unit(random) * height;
+		transforms->width[i] = width;
+		transforms->height[i] = height;
+	}
+}
+
+}	// namespace Zen::Test
+
+#endif
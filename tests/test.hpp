@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#ifndef ZEN_TESTS_TEST_HPP
+#define ZEN_TESTS_TEST_HPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <SDL2/SDL.h>
+#include "../src/zenith.hpp"
+
+namespace Zen::Test {
+
+/**
+ * The exit code of a test that could not run, which CTest reports as skipped.
+ *
+ * @since 0.0.0
+ */
+inline constexpr int SKIPPED = 77;
+
+/**
+ * The size of the game of the tests.
+ *
+ * @since 0.0.0
+ */
+inline constexpr int WIDTH = 800,
+		  HEIGHT = 600;
+
+/**
+ * The number of failed checks.
+ *
+ * @since 0.0.0
+ */
+inline int failures = 0;
+
+/**
+ * Reports a failed check. Use the `ZEN_CHECK` macro instead.
+ *
+ * @since 0.0.0
+ *
+ * @param condition The result of the check.
+ * @param expression The checked expression.
+ * @param file The file of the check.
+ * @param line The line of the check.
+ *
+ * @return The result of the check.
+ */
+inline bool Check (bool condition, const char *expression, const char *file,
+		int line)
+{
+	if (!condition) {
+		std::fprintf(stderr, "%s:%d: Check failed: %s\n", file, line,
+				expression);
+
+		failures++;
+	}
+
+	return condition;
+}
+
+/**
+ * @since 0.0.0
+ *
+ * @return The exit code of the test.
+ */
+inline int GetResult ()
+{
+	if (failures)
+		std::fprintf(stderr, "%d check(s) failed.\n", failures);
+
+	return failures ? 1 : 0;
+}
+
+/**
+ * Runs a game recording its frames instead of drawing them, with a single
+ * scene, until the scene calls `Quit`.
+ *
+ * The recording still needs a window and an OpenGL context. When they can't
+ * be created, as on a machine without a display, the test exits as skipped.
+ *
+ * @since 0.0.0
+ *
+ * @tparam T The scene.
+ * @param setup A function to change the configuration of the game.
+ */
+template <typename T>
+void Run (std::function<void(GameConfig&)> setup = nullptr)
+{
+	GameConfig config;
+
+	config.setWidth(WIDTH)
+		.setHeight(HEIGHT)
+		.setRenderBackend(RENDER_BACKEND::RECORD)
+		.setKeyboardInput(false)
+		.setMouseInput(false)
+		.addScenes<T>();
+
+	if (setup)
+		setup(config);
+
+	Game game (config);
+
+	if (game.hasFailed) {
+		std::fprintf(stderr, "No window or OpenGL context, skipping.\n");
+		std::exit(SKIPPED);
+	}
+}
+
+/**
+ * Stops the game started by `Run` at the end of the current step.
+ *
+ * @since 0.0.0
+ */
+inline void Quit ()
+{
+	SDL_Event event {};
+	event.type = SDL_QUIT;
+
+	SDL_PushEvent(&event);
+}
+
+}	// namespace Zen::Test
+
+/**
+ * Checks a condition, reporting it if it is false.
+ *
+ * @since 0.0.0
+ */
+#define ZEN_CHECK(condition) \
+	Zen::Test::Check((condition), #condition, __FILE__, __LINE__)
+
+#endif
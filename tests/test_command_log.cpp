@@ -0,0 +1,177 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "../src/renderer/pipelines/const.hpp"
+
+namespace Zen {
+extern Renderer g_renderer;
+}
+
+using namespace Zen;
+
+namespace {
+
+/**
+ * The logs of the frames of `LogScene`.
+ */
+enum FRAME_LOG {
+	FIRST = 0,
+	SAME,
+	MOVED,
+	RESTORED,
+	COUNT
+};
+
+/**
+ * Renders three sprites, keeps the log of a frame, of a later frame with
+ * nothing changed, of a frame with a sprite moved, and of a frame with the
+ * sprite moved back.
+ */
+class LogScene : public Scene
+{
+public:
+	/**
+	 * The frames left for a change to be rendered before the log is read.
+	 */
+	static const int SETTLE_FRAMES = 3;
+
+	LogScene ()
+		: Scene("log")
+	{}
+
+	void create (Data) override
+	{
+		for (int i = 0; i < 3; i++)
+			sprites[i] = add.image(100 + i * 200, 200, "__WHITE");
+	}
+
+	void update (Uint32, Uint32) override
+	{
+		if (step >= FRAME_LOG::COUNT)
+			return;
+
+		if (++frame < SETTLE_FRAMES)
+			return;
+
+		frame = 0;
+
+		logs[step] = g_renderer.getCommandLog();
+
+		if (step == FRAME_LOG::FIRST) {
+			vertexSize = g_renderer.pipelines.MULTI_PIPELINE->currentShader
+				->vertexSize;
+			quadVertices = g_renderer.pipelines.MULTI_PIPELINE->indexedQuads
+				? 4 : 6;
+		}
+		else if (step == FRAME_LOG::SAME) {
+			SetX(sprites[1], 350);
+		}
+		else if (step == FRAME_LOG::MOVED) {
+			SetX(sprites[1], 300);
+		}
+		else {
+			Test::Quit();
+		}
+
+		step++;
+	}
+
+	Entity sprites[3];
+
+	int frame = 0;
+
+	int step = FRAME_LOG::FIRST;
+
+	static inline CommandLog logs[FRAME_LOG::COUNT];
+
+	static inline int vertexSize = 0;
+
+	static inline int quadVertices = 0;
+};
+
+/**
+ * Gets the draw calls of the Multi Pipeline in a log.
+ */
+std::vector<const RenderCommand*> GetMultiDraws (const CommandLog& log)
+{
+	std::vector<const RenderCommand*> draws;
+
+	for (auto &command : log.commands)
+		if (command.type == RENDER_COMMAND::DRAW
+				&& command.name == Pipelines::MULTI_PIPELINE)
+			draws.push_back(&command);
+
+	return draws;
+}
+
+/**
+ * Gets a coordinate of a vertex of a draw payload.
+ */
+float GetVertexFloat (const CommandLog& log, const RenderCommand& command,
+		int vertex, int component)
+{
+	auto payload = log.getPayload(command);
+
+	float value = 0.f;
+	std::memcpy(&value, payload.data() + vertex * LogScene::vertexSize
+			+ component * sizeof(float), sizeof(float));
+
+	return value;
+}
+
+}	// namespace
+
+int main ()
+{
+	Test::Run<LogScene>();
+
+	auto &first = LogScene::logs[FRAME_LOG::FIRST];
+
+	// The three sprites share one batch, the frame is presented once
+	ZEN_CHECK(first.count(RENDER_COMMAND::PRESENT) == 1);
+
+	auto draws = GetMultiDraws(first);
+
+	if (ZEN_CHECK(draws.size() == 1)) {
+		auto &draw = *draws[0];
+		int vertices = 3 * LogScene::quadVertices;
+
+		ZEN_CHECK(draw.values[2] == vertices);
+		ZEN_CHECK(draw.payloadSize
+				== static_cast<size_t>(vertices * LogScene::vertexSize));
+
+		// The 4x4 white texture, centered on its position: the first vertex
+		// is the top-left corner, the third the bottom-right one
+		ZEN_CHECK(GetVertexFloat(first, draw, 0, 0) == 98.f);
+		ZEN_CHECK(GetVertexFloat(first, draw, 0, 1) == 198.f);
+		ZEN_CHECK(GetVertexFloat(first, draw, 2, 0) == 102.f);
+		ZEN_CHECK(GetVertexFloat(first, draw, 2, 1) == 202.f);
+	}
+
+	// The same scene records the same log, and a change shows in it
+	auto &same = LogScene::logs[FRAME_LOG::SAME];
+	auto &moved = LogScene::logs[FRAME_LOG::MOVED];
+	auto &restored = LogScene::logs[FRAME_LOG::RESTORED];
+
+	ZEN_CHECK(same.getHash() == first.getHash());
+	ZEN_CHECK(same.toString() == first.toString());
+
+	ZEN_CHECK(moved.getHash() != first.getHash());
+	ZEN_CHECK(moved.commands.size() == first.commands.size());
+
+	ZEN_CHECK(restored.getHash() == first.getHash());
+
+	if (!ZEN_CHECK(restored.toString() == first.toString()))
+		std::fprintf(stderr, "Expected:\n%s\nRecorded:\n%s\n",
+				first.toString().c_str(), restored.toString().c_str());
+
+	return Test::GetResult();
+}
@@ -0,0 +1,139 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include <cstdint>
+#include "test.hpp"
+#include "../src/utils/memory/frame_arena.hpp"
+
+namespace Zen {
+extern FrameArena g_frameArena;
+}
+
+using namespace Zen;
+
+namespace {
+
+/**
+ * A frame of the arena test, overflowing the initial block of the arena.
+ */
+void AllocateFrame (FrameArena& arena)
+{
+	arena.reset();
+
+	for (int i = 0; i < 64; i++) {
+		auto data = arena.allocate<double>(16);
+
+		ZEN_CHECK(reinterpret_cast<std::uintptr_t>(data.data())
+				% alignof(double) == 0);
+
+		data[15] = i;
+	}
+
+	arena.allocate<char>(3);
+
+	ZEN_CHECK(arena.getUsed() >= 64 * 16 * sizeof(double) + 3);
+}
+
+/**
+ * The arena chains blocks for the frame overflowing it, merges them on the
+ * next reset, then stops allocating.
+ */
+void TestArena ()
+{
+	FrameArena arena (1024);
+
+	AllocateFrame(arena);
+	ZEN_CHECK(arena.blockAllocations > 1);
+
+	AllocateFrame(arena);
+
+	int blocks = arena.blockAllocations;
+	long heap = GetHeapAllocationCount();
+
+	for (int i = 0; i < 8; i++)
+		AllocateFrame(arena);
+
+	ZEN_CHECK(arena.blockAllocations == blocks);
+	ZEN_CHECK(GetHeapAllocationCount() == heap);
+}
+
+/**
+ * Renders the same Game Objects every frame, moving them, and checks the
+ * frames settle on making no heap allocation at all.
+ */
+class SteadyScene : public Scene
+{
+public:
+	static const int WARMUP_FRAMES = 30;
+
+	static const int MEASURED_FRAMES = 30;
+
+	SteadyScene ()
+		: Scene("steady")
+	{}
+
+	void create (Data) override
+	{
+		for (int i = 0; i < 500; i++) {
+			sprites[i] = add.image(10 + (i * 37) % (Test::WIDTH - 20),
+					10 + (i * 53) % (Test::HEIGHT - 20),
+					(i % 3) ? "__WHITE" : "__DEFAULT");
+
+			SetScale(sprites[i], 0.25);
+		}
+	}
+
+	void update (Uint32, Uint32) override
+	{
+		if (frame >= WARMUP_FRAMES + MEASURED_FRAMES)
+			return;
+
+		for (int i = 0; i < 500; i++)
+			SetRotation(sprites[i], frame * 0.01 * (i % 7));
+
+		// The count of the previous frame, reported by the reset of this one
+		if (frame >= WARMUP_FRAMES)
+			allocations[frame - WARMUP_FRAMES] =
+				g_frameArena.lastFrameHeapAllocations;
+
+		frame++;
+
+		if (frame == WARMUP_FRAMES + MEASURED_FRAMES)
+			Test::Quit();
+	}
+
+	Entity sprites[500];
+
+	int frame = 0;
+
+	static inline long allocations[MEASURED_FRAMES] {};
+};
+
+}	// namespace
+
+int main ()
+{
+	TestArena();
+
+	if (GetHeapAllocationCount() < 0) {
+		std::printf("Built without ZEN_COUNT_ALLOCATIONS, the frames are not "
+				"measured.\n");
+
+		return Test::GetResult();
+	}
+
+	Test::Run<SteadyScene>();
+
+	for (int i = 0; i < SteadyScene::MEASURED_FRAMES; i++) {
+		if (!ZEN_CHECK(SteadyScene::allocations[i] == 0))
+			std::fprintf(stderr, "Frame %d made %ld heap allocations.\n",
+					SteadyScene::WARMUP_FRAMES + i,
+					SteadyScene::allocations[i]);
+	}
+
+	return Test::GetResult();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "test.hpp"
+
+namespace Zen {
+extern Renderer g_renderer;
+}
+
+using namespace Zen;
+
+namespace {
+
+/**
+ * Renders the same sprites with a single texture and blend mode, then
+ * alternating two blend modes, then alternating two textures, and keeps the
+ * stats of a frame of each.
+ */
+class StatsScene : public Scene
+{
+public:
+	static const int SPRITES = 100;
+
+	/**
+	 * The frames left for a change to be rendered before the stats are read.
+	 */
+	static const int SETTLE_FRAMES = 3;
+
+	StatsScene ()
+		: Scene("stats")
+	{}
+
+	void create (Data) override
+	{
+		for (int i = 0; i < SPRITES; i++)
+			sprites[i] = add.image(20 + (i % 10) * 70, 20 + (i / 10) * 50,
+					"__WHITE");
+	}
+
+	void update (Uint32, Uint32) override
+	{
+		if (step > 2)
+			return;
+
+		if (++frame < SETTLE_FRAMES)
+			return;
+
+		frame = 0;
+
+		stats[step] = g_renderer.getStats();
+		quadVertices = g_renderer.pipelines.MULTI_PIPELINE->indexedQuads
+			? 4 : 6;
+
+		if (step == 0) {
+			for (int i = 0; i < SPRITES; i++)
+				SetBlendMode(sprites[i], (i % 2) ? BLEND_MODE::NORMAL
+						: BLEND_MODE::ADD);
+		}
+		else if (step == 1) {
+			for (int i = 0; i < SPRITES; i++) {
+				SetBlendMode(sprites[i], BLEND_MODE::NORMAL);
+				SetTexture(sprites[i], (i % 2) ? "__WHITE" : "__DEFAULT");
+			}
+		}
+		else {
+			Test::Quit();
+		}
+
+		step++;
+	}
+
+	Entity sprites[SPRITES];
+
+	int frame = 0;
+
+	int step = 0;
+
+	static inline RenderStats stats[3];
+
+	static inline int quadVertices = 0;
+};
+
+}	// namespace
+
+int main ()
+{
+	Test::Run<StatsScene>();
+
+	const int vertices = StatsScene::SPRITES * StatsScene::quadVertices;
+
+	// A single texture and blend mode fit in one batch
+	auto &single = StatsScene::stats[0];
+	ZEN_CHECK(single.drawCalls == 1);
+	ZEN_CHECK(single.flushes == 1);
+	ZEN_CHECK(single.vertices == vertices);
+
+	// Every change of blend mode ends the batch
+	auto &blended = StatsScene::stats[1];
+	ZEN_CHECK(blended.drawCalls == StatsScene::SPRITES);
+	ZEN_CHECK(blended.flushes == StatsScene::SPRITES);
+	ZEN_CHECK(blended.getFlushes(FLUSH_REASON::BLEND)
+			>= StatsScene::SPRITES - 1);
+	ZEN_CHECK(blended.vertices == vertices);
+
+	// The textures are bound to their own units, in the same batch
+	auto &textured = StatsScene::stats[2];
+	ZEN_CHECK(textured.drawCalls == 1);
+	ZEN_CHECK(textured.flushes == 1);
+	ZEN_CHECK(textured.getFlushes(FLUSH_REASON::TEXTURE_UNITS) == 0);
+	ZEN_CHECK(textured.vertices == vertices);
+
+	return Test::GetResult();
+}
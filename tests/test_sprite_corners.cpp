@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "test.hpp"
+#include "sprite_corners_data.hpp"
+
+using namespace Zen;
+
+namespace {
+
+const float WIDTH = Test::WIDTH,
+	  HEIGHT = Test::HEIGHT;
+
+/**
+ * Are two corners the same, give or take the rounding errors of a different
+ * order of operations?
+ */
+bool IsNear (float value, float reference)
+{
+	return std::abs(value - reference)
+		<= 1e-4f * std::max(1.f, std::abs(reference));
+}
+
+/**
+ * Is a corner close enough to a half pixel for rounding errors to round it
+ * the other way?
+ */
+bool IsNearHalf (float value)
+{
+	float fraction = std::abs(value - std::trunc(value));
+
+	return std::abs(fraction - 0.5f) < 1e-3f;
+}
+
+/**
+ * Is a Sprite close enough to an edge of the screen for rounding errors to
+ * change its visibility?
+ */
+bool IsNearEdge (const SpriteCorners& corners, size_t i)
+{
+	float l = corners.x[0][i], r = l, top = corners.y[0][i], bottom = top;
+
+	for (int k = 1; k < 4; k++) {
+		l = std::min(l, corners.x[k][i]);
+		r = std::max(r, corners.x[k][i]);
+		top = std::min(top, corners.y[k][i]);
+		bottom = std::max(bottom, corners.y[k][i]);
+	}
+
+	return std::abs(l - WIDTH) <= 1.f || std::abs(r) <= 1.f
+		|| std::abs(top - HEIGHT) <= 1.f || std::abs(bottom) <= 1.f;
+}
+
+/**
+ * Compares the kernel with the plain code, for a run of the given length.
+ */
+void TestRun (size_t count, bool roundPixels)
+{
+	SpriteTransforms transforms;
+	Test::FillSpriteTransforms(count, count * 2 + roundPixels, &transforms);
+
+	SpriteCorners corners;
+	TransformSpriteCorners(transforms, roundPixels, WIDTH, HEIGHT, &corners);
+
+	SpriteCorners reference;
+	reference.resize(count);
+	TransformSpriteCornersScalar(transforms, roundPixels, WIDTH, HEIGHT,
+			&reference);
+
+	SpriteCorners unrounded;
+	unrounded.resize(count);
+	TransformSpriteCornersScalar(transforms, false, WIDTH, HEIGHT, &unrounded);
+
+	ZEN_CHECK(corners.visible.size() == count);
+
+	for (size_t i = 0; i < count; i++) {
+		for (int k = 0; k < 4; k++) {
+			float x = corners.x[k][i], y = corners.y[k][i];
+			float refX = reference.x[k][i], refY = reference.y[k][i];
+
+			bool same;
+			if (roundPixels)
+				same = (x == refX || (std::abs(x - refX) <= 1.f
+							&& IsNearHalf(unrounded.x[k][i])))
+					&& (y == refY || (std::abs(y - refY) <= 1.f
+							&& IsNearHalf(unrounded.y[k][i])));
+			else
+				same = IsNear(x, refX) && IsNear(y, refY);
+
+			if (!ZEN_CHECK(same))
+				std::fprintf(stderr, "Run of %zu, sprite %zu, corner %d: "
+						"(%f, %f) instead of (%f, %f).\n", count, i, k, x, y,
+						refX, refY);
+		}
+
+		if (corners.visible[i] != reference.visible[i]
+				&& !ZEN_CHECK(IsNearEdge(unrounded, i)))
+			std::fprintf(stderr, "Run of %zu, sprite %zu: visibility %d "
+					"instead of %d.\n", count, i, corners.visible[i],
+					reference.visible[i]);
+	}
+}
+
+}	// namespace
+
+int main ()
+{
+#if defined(__AVX2__)
+	std::printf("Checking the AVX2 kernel.\n");
+#elif defined(__SSE2__)
+	std::printf("Checking the SSE2 kernel.\n");
+#else
+	std::printf("Built without vector instructions, only the plain code is "
+			"checked.\n");
+#endif
+
+	// Every tail length of both vector widths, and a long run
+	for (size_t count : {0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 15, 16, 17, 23, 31, 33,
+			1001}) {
+		TestRun(count, false);
+		TestRun(count, true);
+	}
+
+	// A run fully off the screen, and one fully on it
+	SpriteTransforms transforms;
+	Test::FillSpriteTransforms(13, 42, &transforms);
+
+	SpriteCorners corners;
+
+	for (size_t i = 0; i < 13; i++) {
+		transforms.tx[i] = -10000.f;
+		transforms.ty[i] = 10000.f;
+	}
+
+	TransformSpriteCorners(transforms, false, WIDTH, HEIGHT, &corners);
+	ZEN_CHECK(std::count(corners.visible.begin(), corners.visible.end(), 0)
+			== 13);
+
+	for (size_t i = 0; i < 13; i++) {
+		transforms.tx[i] = WIDTH / 2.f;
+		transforms.ty[i] = HEIGHT / 2.f;
+	}
+
+	TransformSpriteCorners(transforms, false, WIDTH, HEIGHT, &corners);
+	ZEN_CHECK(std::count(corners.visible.begin(), corners.visible.end(), 1)
+			== 13);
+
+	return Test::GetResult();
+}
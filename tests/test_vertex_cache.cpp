@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @author		__AUTHOR_NAME__ <mail@host.com>
+ * @copyright	2021 __COMPANY_LTD__
+ * @license		<a href="https://opensource.org/licenses/MIT">MIT License</a>
+ */
+
+#include "test.hpp"
+
+namespace Zen {
+extern Renderer g_renderer;
+}
+
+using namespace Zen;
+
+namespace {
+
+/**
+ * The stats of the frames of `CacheScene`.
+ */
+enum FRAME_STATS {
+	STATIC = 0,
+	MOVED,
+	SETTLED,
+	COUNT
+};
+
+/**
+ * Renders static sprites retaining their vertices among sprites that don't,
+ * with the default configuration, and moves one of the static sprites once.
+ */
+class CacheScene : public Scene
+{
+public:
+	static const int CACHED = 50;
+
+	static const int PLAIN = 10;
+
+	/**
+	 * The update reading the stats of a frame with nothing changed, before
+	 * moving a sprite.
+	 */
+	static const int MOVE_UPDATE = 5;
+
+	/**
+	 * The update reading the stats of the frames after.
+	 */
+	static const int LAST_UPDATE = 10;
+
+	CacheScene ()
+		: Scene("cache")
+	{}
+
+	void create (Data) override
+	{
+		for (int i = 0; i < CACHED; i++) {
+			cached[i] = add.image(20 + (i % 10) * 70, 20 + (i / 10) * 50,
+					"__WHITE");
+
+			SetVertexCache(cached[i]);
+		}
+
+		for (int i = 0; i < PLAIN; i++)
+			add.image(20 + i * 70, 400, "__WHITE");
+	}
+
+	void update (Uint32, Uint32) override
+	{
+		if (updates > LAST_UPDATE)
+			return;
+
+		// The stats are of the frame rendered after the previous update
+		updates++;
+
+		if (updates == MOVE_UPDATE) {
+			stats[FRAME_STATS::STATIC] = g_renderer.getStats();
+
+			SetX(cached[0], 30);
+		}
+		else if (updates == MOVE_UPDATE + 1) {
+			stats[FRAME_STATS::MOVED] = g_renderer.getStats();
+		}
+		else if (updates == LAST_UPDATE) {
+			stats[FRAME_STATS::SETTLED] = g_renderer.getStats();
+			quadVertices = g_renderer.pipelines.MULTI_PIPELINE->indexedQuads
+				? 4 : 6;
+
+			Test::Quit();
+		}
+	}
+
+	Entity cached[CACHED];
+
+	int updates = 0;
+
+	static inline RenderStats stats[FRAME_STATS::COUNT];
+
+	static inline int quadVertices = 0;
+};
+
+}	// namespace
+
+int main ()
+{
+	Test::Run<CacheScene>();
+
+	const int total = CacheScene::CACHED + CacheScene::PLAIN;
+
+	// Only the sprites without a cache are computed
+	auto &still = CacheScene::stats[FRAME_STATS::STATIC];
+	ZEN_CHECK(still.cachedSprites == CacheScene::CACHED);
+	ZEN_CHECK(still.computedSprites == CacheScene::PLAIN);
+
+	// The moved sprite is computed again, once
+	auto &moved = CacheScene::stats[FRAME_STATS::MOVED];
+	ZEN_CHECK(moved.cachedSprites == CacheScene::CACHED - 1);
+	ZEN_CHECK(moved.computedSprites == CacheScene::PLAIN + 1);
+
+	auto &settled = CacheScene::stats[FRAME_STATS::SETTLED];
+	ZEN_CHECK(settled.cachedSprites == CacheScene::CACHED);
+	ZEN_CHECK(settled.computedSprites == CacheScene::PLAIN);
+	ZEN_CHECK(settled.vertices == total * CacheScene::quadVertices);
+
+	return Test::GetResult();
+}